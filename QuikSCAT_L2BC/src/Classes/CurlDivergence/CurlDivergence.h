@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <vector>
+#include <map>
 #include <bitset>
 #include <netcdfcpp.h>
 #include <blitz/array.h>
@@ -23,29 +24,53 @@
 typedef enum {WIND_VECTOR_FIELD, STRESS_VECTOR_FIELD} VectorFieldType;
 
 /*!
-  \brief Make the curl and divergence of a vector field sampled on a lat/lon grid.
+  \brief Least-squares derivative weights for one window mask pattern.
+
+  A least-squares fit of the field depends only on the window
+  lat/lon offsets and on which pixels of the window are good, so the
+  derivatives are fixed linear combinations of the differences
+  A(i,j) - A(center). The same weights serve both field components and,
+  on a regular grid, every pixel of a row with the same mask pattern.
+  The good pixels are listed by their offsets from the center.
 */
 
-class CurlDivergence {
+class DerivativeStencil {
 public:
+  bool ok; //!< false if the fit can not be done for this pattern
+  std::vector<int> di; //!< row offsets of the good pixels
+  std::vector<int> dj; //!< column offsets of the good pixels
+  std::vector<double> w_lon; //!< weights giving dA/dlon
+  std::vector<double> w_lat; //!< weights giving dA/dlat
+};
 
-  //! Open the netcdf file and read the data
+/*!
+  \brief Make the curl and divergence of a vector field held in memory.
 
-  CurlDivergence(const char* l2b_file_name,
-		 VectorFieldType vectorFieldType = WIND_VECTOR_FIELD,
-		 NcError::Behavior b = NcError::verbose_fatal);
+  The grid and the field are set from arrays, so the calculation can be
+  done on a whole file (see CurlDivergence) or on a block of rows.
+*/
 
-  //! Create the mask of good input variables based on the desired list of flags
+class CurlDivergenceField {
+public:
 
-  void create_input_mask(std::vector<int>& bit_position, //! position of the bit to test
-			 std::vector<bool>& bit_value //! value the bit should have
-			 );
+  CurlDivergenceField();
 
-  //! Update the flag values to take into account the smoothing filter mask
+  //! Set the grid and field from lat/lon (degrees), magnitude and direction
+  //! (degrees). The arrays are referenced, and the angles are converted to
+  //! radians in place.
 
-  void update_flags(blitz::Array<bool, 2>& output_mask,  //!< Smoothing filter mask
-		    int output_bit_position       //!< bit to set if data was not smoothed
-		    );
+  void set_vector_field(blitz::Array<float, 2>& lat_deg, //!< latitude (in degrees)
+			blitz::Array<float, 2>& lon_deg, //!< longitude (in degrees)
+			blitz::Array<float, 2>& mag, //!< field magnitude
+			blitz::Array<float, 2>& dir_deg //!< field direction (in degrees)
+			);
+
+  //! Create the mask of good input variables from a flag field
+
+  void create_input_mask(blitz::Array<short, 2>& wvc_quality_flag, //! flags to test
+			 std::vector<int>& bit_position, //! position of the bit to test
+			 std::vector<bool>& bit_value //! value the bit should have
+			 );
 
   //! Compute the curl and divergence
 
@@ -55,18 +80,14 @@ public:
 			   float missing_data_value, //!< value to use for fill when estimate is not possible
 			   int row_radius, //!< number of pixels to left or right of point to use in estimates
 			   int col_radius, //!< number of pixels up or down from point to use in estimates
-			   int min_good //!< minimum number of good observations per fit
+			   int min_good, //!< minimum number of good observations per fit
+			   int nthreads = 1 //!< number of threads (rows are split into bands)
 			   );	
 
   // Data members
 
   double earth_radius;
 
-  NcError ncError; //!< netcdf error behavior
-  NcFile ncFile; //!< pointer to the open netcdf file
-  
-  VectorFieldType vectorFieldType;
-
   blitz::Array<bool, 2> input_mask; 
 
   blitz::Array<float, 2> A_phi; //!< meridional component (e.g., U)
@@ -83,26 +104,29 @@ public:
   //
   ////////////////////////////////////////////////////////////////////////
 
-  // Get the derivatives of a vector field. Return true if successful, false if not.
-
-  bool get_lat_lon_derivative(blitz::Array<float, 2>& A,
-				       int i,
-				       int j,
-				       int row_radius,
-				       int col_radius,
-				       int min_good,
-				       double& dA_dlon,
-				       double& dA_dlat
-				       );
-  // Load the sensitivity matrix
-
- int load_sensitivity_matrix( blitz::Array<float, 2>& A,
-			      int i,
-			      int j,
-			      int row_radius,
-			      int col_radius,
-			      blitz::Array<double, 2>& X, // This is the matrix to solve XC = y
-			      blitz::Array<double, 1>& Y);
+  // Compute the curl and divergence for rows [first_row, last_row),
+  // using cached stencils where the grid is regular
+
+  void get_curl_divergence_rows(blitz::Array<float, 2>& curl,
+				blitz::Array<float, 2>& div,
+				blitz::Array<bool, 2>& output_mask,
+				float missing_data_value,
+				int row_radius,
+				int col_radius,
+				int min_good,
+				int first_row,
+				int last_row);
+
+  // True if every window centered in row i has the same lat/lon offsets
+
+  bool row_is_regular(int i, int row_radius, int col_radius);
+
+  // Build the stencil for the window geometry centered at (i,j). good
+  // flags the usable window pixels in row major order.
+
+  void make_stencil(int i, int j, int row_radius, int col_radius,
+		    const std::vector<char>& good,
+		    DerivativeStencil& stencil);
 
  // Get the curl and divergence from the field components and derivatives
 
@@ -114,5 +138,39 @@ public:
 
 };
 
+/*!
+  \brief Make the curl and divergence of a vector field sampled on a lat/lon grid.
+*/
+
+class CurlDivergence : public CurlDivergenceField {
+public:
+
+  //! Open the netcdf file and read the data
+
+  CurlDivergence(const char* l2b_file_name,
+		 VectorFieldType vectorFieldType = WIND_VECTOR_FIELD,
+		 NcError::Behavior b = NcError::verbose_fatal);
+
+  //! Create the mask of good input variables based on the desired list of flags
+
+  void create_input_mask(std::vector<int>& bit_position, //! position of the bit to test
+			 std::vector<bool>& bit_value //! value the bit should have
+			 );
+
+  //! Update the flag values to take into account the smoothing filter mask
+
+  void update_flags(blitz::Array<bool, 2>& output_mask,  //!< Smoothing filter mask
+		    int output_bit_position       //!< bit to set if data was not smoothed
+		    );
+
+  // Data members
+
+  NcError ncError; //!< netcdf error behavior
+  NcFile ncFile; //!< pointer to the open netcdf file
+  
+  VectorFieldType vectorFieldType;
+
+};
+
 
 #endif
@@ -36,18 +36,39 @@ public:
 		 const char* filtered_l2b_file_name,
 		NcError::Behavior b = NcError::verbose_fatal);
 
-  //! Create the mask of good input variables based on the desired list of flags
+  //! Create the mask of good input variables based on the desired list of flags.
+  //! Only nrows rows starting at row_index are read (nrows = 0 reads to the end).
 
   void create_input_mask(std::vector<int>& bit_position, //! position of the bit to test
-			 std::vector<bool>& bit_value //! value the bit should have
+			 std::vector<bool>& bit_value, //! value the bit should have
+			 int row_index = 0, //!< first row to read
+			 int nrows = 0 //!< number of rows to read
 			 );
 
+  //! Make a mask that is true where the flag bits have the desired values
+
+  static void make_input_mask(blitz::Array<short, 2>& wvc_quality_flag, //!< flags to test
+			      std::vector<int>& bit_position, //! position of the bit to test
+			      std::vector<bool>& bit_value, //! value the bit should have
+			      blitz::Array<bool, 2>& mask //!< returns the mask
+			      );
+
+  //! Set a flag bit where the mask is false, and clear it where the mask is true
+
+  static void set_flag_bit(blitz::Array<short, 2>& wvc_quality_flag, //!< flags to update
+			   blitz::Array<bool, 2>& mask, //!< data mask
+			   int bit_position //!< bit to set if the mask is false
+			   );
+
   //! Filter the directions and return smoothed field and mask
 
   void filter_directions(int nsmooth, //!< size of smoothing window
 			 int min_good, //!< minimum number of good points in window
 			 blitz::Array<float, 2>& wind_dir_smooth, //!< returns the smoothed direction
-			 blitz::Array<bool, 2>& output_mask //!< returns the output mask
+			 blitz::Array<bool, 2>& output_mask, //!< returns the output mask
+			 int nthreads = 1, //!< number of threads for the median filter
+			 int row_index = 0, //!< first row to read (as in create_input_mask)
+			 int nrows = 0 //!< number of rows to read
 			 );
 
   //! Filter the speeds and return smoothed field and mask
@@ -55,7 +76,10 @@ public:
   void filter_speeds(int nsmooth, //!< size of smoothing window
 		       int min_good, //!< minimum number of good points in window
 		       blitz::Array<float, 2>& wind_speed_smooth, //!< returns the smoothed direction
-		       blitz::Array<bool, 2>& output_mask //!< returns the output mask
+		       blitz::Array<bool, 2>& output_mask, //!< returns the output mask
+		       int nthreads = 1, //!< number of threads for the median filter
+		       int row_index = 0, //!< first row to read (as in create_input_mask)
+		       int nrows = 0 //!< number of rows to read
 		       );
 
   //! Update the flag values to take into account the smoothing filter mask
@@ -67,7 +91,7 @@ public:
   //! AHChau 6/3/12.  Copy the eflags from the input file to the output file
   void copy_eflags();
   //! AHChau 6/5/12.  When speed is -9999, change direction to be -9999 as well
-  void make_dir_consistent_with_spd();
+  void make_dir_consistent_with_spd(int row_index = 0, int nrows = 0);
 
   // Data members
 
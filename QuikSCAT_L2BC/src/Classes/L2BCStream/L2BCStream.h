@@ -0,0 +1,84 @@
+/*!
+  \file L2BCStream.h
+  \brief Make the filtered winds, stress, curl and divergence in one pass over an l2bc file.
+*/
+
+#ifndef _ER_L2BCSTREAM_H_
+#define _ER_L2BCSTREAM_H_
+
+#include <vector>
+#include <netcdfcpp.h>
+#include <blitz/array.h>
+#include "NC2Blitz.h"
+#include "Exception.h"
+#include "L2BCconstants.h"
+#include "FilterL2BWinds.h"
+#include "CurlDivergence.h"
+#include "WindStress.h"
+
+/*!
+  \brief Make the filtered winds, stress, curl and divergence in one pass over an l2bc file.
+
+  The grid is processed in blocks of along-track rows. Each block reads
+  the unfiltered rows it needs plus the halo required by the median
+  filter and the curl/divergence windows, and the halo rows are
+  recomputed with the block. The results are the same as running
+  makeFilteredWinds and then makeCurlDivergence for the wind and the
+  stress over the whole file, but only a block of rows is held in memory.
+
+  Each step reads back the values written by the previous one, so the
+  conversions done by the netcdf variable types are the same as when
+  the steps are separate programs.
+*/
+
+class L2BCStream {
+public:
+
+  //! Open the unfiltered (input) and filtered (output) files
+
+  L2BCStream(const char* unfiltered_l2b_file_name,
+	     const char* filtered_l2b_file_name,
+	     NcError::Behavior b = NcError::verbose_fatal);
+
+  //! Process the whole file, block_rows rows at a time
+
+  void process(int block_rows);
+
+  //! Process rows [first_row, last_row)
+
+  void process_block(int first_row, int last_row);
+
+  // Median filter settings (as in makeFilteredWinds)
+
+  int filter_window; //!< size of the smoothing window
+  int filter_min_good; //!< minimum number of good points in window
+  int filter_output_bit; //!< bit to set if data was not smoothed
+  std::vector<int> filter_bit_position; //!< flag bits checked for good data
+  std::vector<bool> filter_bit_value; //!< flag bit values for good data
+
+  // Curl and divergence settings (as in makeCurlDivergence)
+
+  int curl_window; //!< size of the estimation window
+  int curl_min_good; //!< minimum number of good points per fit
+  int wind_curl_output_bit; //!< bit to set if the wind curl failed
+  std::vector<int> curl_bit_position; //!< eflags bits checked for good data
+  std::vector<bool> curl_bit_value; //!< eflags bit values for good data
+
+  // Stress settings
+
+  bool make_stress; //!< if true, make the stress and its curl and divergence
+  WindStressModel stress_model; //!< drag coefficient model
+  int stress_curl_output_bit; //!< bit to set if the stress curl failed
+
+  int nthreads; //!< threads for the median filter and the curl/divergence
+
+  // Data members
+
+  FilterL2BWinds l2bc; //!< holds the open input and output files
+
+  int nrows; //!< number of along-track rows
+  int ncols; //!< number of cross-track columns
+
+};
+
+#endif
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <pthread.h>
 #include <blitz/array.h>
 
 /*! 
@@ -27,11 +28,154 @@ T median(std::vector<T>& v,
   return v[mid-1];
 }
 
+/*!
+  Running median of a window that changes a few values at a time.  The
+  values are kept sorted, so adding or removing one costs a binary
+  search and a short move, and the median is a lookup. The median is the
+  same element median(std::vector) picks: the ((n+1)/2)-th smallest.
+*/
+
+template <class T>
+class SlidingMedian {
+public:
+
+  SlidingMedian(int capacity = 0) : sorted(capacity), n(0) {}
+
+  void clear() { n = 0; }
+
+  //! insert after any equal values, shifting the larger ones up
+  void add(const T& x) {
+    if( n == int(sorted.size()) ) sorted.resize(2*n+1);
+    int i = n++;
+    while( (i > 0) && (x < sorted[i-1]) ){
+      sorted[i] = sorted[i-1];
+      i--;
+    }
+    sorted[i] = x;
+  }
+
+  void remove(const T& x) {
+    int i = std::lower_bound(sorted.begin(),sorted.begin()+n,x) - sorted.begin();
+    if( i == n ) return;
+    for(n--; i < n; i++) sorted[i] = sorted[i+1];
+  }
+
+  int size() const { return n; }
+
+  T median() const { return sorted[(n+1)/2 - 1]; }
+
+private:
+
+  std::vector<T> sorted; //!< the window values, in increasing order
+  int n;                 //!< number of values in the window
+};
+
+/*!
+  The rows of the 2D median filter handled by one thread.
+*/
+
+template <class T>
+struct MedianRows {
+  const blitz::Array<T, 2>* input_array;
+  const blitz::Array<bool, 2>* input_mask;
+  blitz::Array<T, 2>* output_array;
+  blitz::Array<bool, 2>* output_mask;
+  int minGood;
+  int rowRadius;
+  int colRadius;
+  int first_row; //!< first row to filter
+  int last_row;  //!< one past the last row to filter
+};
+
+/*!
+  Filter rows [first_row, last_row). The window is moved along each row
+  one column at a time: the column leaving the window is removed and the
+  column entering it is added, so each output costs O(window height)
+  updates instead of a sort of the whole window.
+*/
+
+template <class T>
+void
+median_rows(MedianRows<T>& job){
+
+  const blitz::Array<T, 2>& input_array = *job.input_array;
+  const blitz::Array<bool, 2>& input_mask = *job.input_mask;
+  blitz::Array<T, 2>& output_array = *job.output_array;
+  blitz::Array<bool, 2>& output_mask = *job.output_mask;
+  int rowRadius = job.rowRadius;
+  int colRadius = job.colRadius;
+  int cols = input_array.cols();
+
+  SlidingMedian<T> window((2*rowRadius+1)*(2*colRadius+1));
+
+  // element (n,m) of the window rows is value[n][m*stride], and the same
+  // for the mask
+  int height = 2*rowRadius+1;
+  std::vector<const T*> value(height);
+  std::vector<const bool*> good(height);
+  int value_stride = input_array.stride(1);
+  int good_stride = input_mask.stride(1);
+
+  for(int i = job.first_row; i < job.last_row; i++){
+
+    for(int n = 0; n < height; n++){
+      value[n] = &input_array(i-rowRadius+n,0);
+      good[n] = &input_mask(i-rowRadius+n,0);
+    }
+
+    // the window for the first output column, less its last column
+
+    window.clear();
+    for(int n = 0; n < height; n++){
+      for(int m = 0; m < 2*colRadius; m++){
+        if( good[n][m*good_stride] ) window.add(value[n][m*value_stride]);
+      }
+    }
+
+    for(int j = colRadius; j < cols-colRadius; j++){
+
+      // bring in the new column
+
+      int m = j + colRadius;
+      for(int n = 0; n < height; n++){
+        if( good[n][m*good_stride] ) window.add(value[n][m*value_stride]);
+      }
+
+      // Fill in the result. As before, nothing is filtered if the
+      // center value is not good.
+
+      if( input_mask(i,j) && (window.size() > job.minGood) ){
+        output_array(i,j) = window.median();
+        output_mask(i,j) = true;
+      }
+      else {
+        output_array(i,j) = input_array(i,j);
+        output_mask(i,j) = false;
+      }
+
+      // drop the oldest column
+
+      m = j - colRadius;
+      for(int n = 0; n < height; n++){
+        if( good[n][m*good_stride] ) window.remove(value[n][m*value_stride]);
+      }
+    }
+  }
+}
+
+template <class T>
+void*
+median_rows_thread(void* job){
+  median_rows(*static_cast<MedianRows<T>*>(job));
+  return NULL;
+}
+
 /*!
     Median filter of a matrix whose type allows the use of an ordering operator.
     Only unmasked points are used to form the result. The output will have the
     filtered values, when valid, or the original values, when not valid. These
-    can be differentiated using the output mask.
+    can be differentiated using the output mask. The rows are split into
+    nthreads bands that are filtered in parallel.
 */
 
 template<class T>
@@ -42,11 +186,10 @@ median(const blitz::Array<T, 2> & input_array, //!< Matrix to smooth (not change
        int nsmooth,   //!< smoothing size for rows
        int msmooth,  //!< smoothing size for columns
        blitz::Array<T, 2> & output_array, //!< Median filtered result (resized to match input array)
-       blitz::Array<bool, 2>& output_mask //!< These are the filtered points mask
+       blitz::Array<bool, 2>& output_mask, //!< These are the filtered points mask
+       int nthreads = 1 //!< number of threads to use
        ){
 
-  int i,j,n,m;
-
   // resize result arrays
   
   output_array.resize(input_array.rows(),input_array.cols());
@@ -82,38 +225,40 @@ median(const blitz::Array<T, 2> & input_array, //!< Matrix to smooth (not change
   output_array(all,col_range_low) = input_array(all,col_range_low);
   output_array(all,col_range_high) = input_array(all,col_range_high);
 
-  // This vector holds the data temprarily
-  
-  std::vector<T> buffer(nsmooth*msmooth);
-  
-  //Process one row at a time
-  
-  for(i = rowRadius; i< input_array.rows()-rowRadius; i++){
-    for(j = colRadius; j < input_array.cols()-colRadius; j++){
-    
-        // select the good points to filter
-        
-        int good = 0;
-	// AHChau 6/3/12, add this if statement, so that no filtering will be performed if the center value is not good.  
-	if( input_mask(i,j) ){ 
-	  for(n = i-rowRadius; n <= i+rowRadius; n++){
-            for(m = j - colRadius; m <= j + colRadius; m++){
-	      if( input_mask(n,m) ) buffer[good++] = input_array(n,m);
-            }
-	  }
-	}
-
-        // Fill in the result
-        
-        if(good > minGood){
-  	  output_array(i,j) = median(buffer,good);
-  	  output_mask(i,j) = true;
-  	}
-  	else {
-  	  output_array(i,j) = input_array(i,j);
-  	  output_mask(i,j) = false;
-  	}
-    }
+  // Split the rows into bands, one per thread
+
+  int first_row = rowRadius;
+  int last_row = input_array.rows()-rowRadius;
+  if( nthreads < 1 ) nthreads = 1;
+  if( nthreads > last_row - first_row ) nthreads = last_row - first_row;
+
+  std::vector< MedianRows<T> > jobs(nthreads);
+  for(int t = 0; t < nthreads; t++){
+    MedianRows<T>& job = jobs[t];
+    job.input_array = &input_array;
+    job.input_mask = &input_mask;
+    job.output_array = &output_array;
+    job.output_mask = &output_mask;
+    job.minGood = minGood;
+    job.rowRadius = rowRadius;
+    job.colRadius = colRadius;
+    job.first_row = first_row + (t*(last_row-first_row))/nthreads;
+    job.last_row = first_row + ((t+1)*(last_row-first_row))/nthreads;
+  }
+
+  // The first band is done here; a band whose thread can not be
+  // started is done here too.
+
+  std::vector<pthread_t> threads(nthreads);
+  std::vector<bool> started(nthreads,false);
+  for(int t = 1; t < nthreads; t++){
+    started[t] = ( pthread_create(&threads[t],NULL,median_rows_thread<T>,
+                                  &jobs[t]) == 0 );
+  }
+  median_rows(jobs[0]);
+  for(int t = 1; t < nthreads; t++){
+    if( started[t] ) pthread_join(threads[t],NULL);
+    else median_rows(jobs[t]);
   }
 
 }
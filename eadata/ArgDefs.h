@@ -329,6 +329,9 @@ static const char rcs_argdefs_h[] =
 #define STAT_NUM_FRAMES_KEYWORD     "STAT_NUM_FRAMES"
 #define STAT_NUM_FRAMES_OPTION      "-statNumFrames"
 #define STAT_NUM_FRAMES_ARGUMENT    "numFrames"
+#define NUM_WORKERS_KEYWORD         "NUM_WORKERS"
+#define NUM_WORKERS_OPTION          "-workers"
+#define NUM_WORKERS_ARGUMENT        "numWorkers"
 
 //==============================
 // toggle options (no argument) 
@@ -494,5 +497,7 @@ static const char rcs_argdefs_h[] =
     {APPEND_OUTPUT_KEYWORD, APPEND_OUTPUT_OPTION, "0"}
 #define STAT_NUM_FRAMES_ARG   \
     {STAT_NUM_FRAMES_KEYWORD, STAT_NUM_FRAMES_OPTION, STAT_NUM_FRAMES_ARGUMENT}
+#define NUM_WORKERS_ARG   \
+    {NUM_WORKERS_KEYWORD, NUM_WORKERS_OPTION, NUM_WORKERS_ARGUMENT}
 
 #endif
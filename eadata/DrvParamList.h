@@ -44,6 +44,9 @@ public:
     virtual StatusE    HoldExtract(TlmHdfFile*       tlmFile,
                                    int32             startIndex,
                                    PolynomialTable*  polyTable=0);
+
+    // derived values expand to many rows per frame, held in one step
+    virtual IotBoolean CanHoldRecords(void) { return(0); }
 protected:
     void    _getThisPlusTime(
                            TlmHdfFile*    tlmFile,
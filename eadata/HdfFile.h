@@ -88,6 +88,39 @@ inline int operator==(const HdfGlobalAttr& a, const HdfGlobalAttr& b)
     return(strcmp(a.name, b.name) == 0 && a.type == b.type ? 1 : 0);
 }
 
+//-------------------------------------------------------------------
+// HdfDatasetBlock:
+//  A block of consecutive records of one dataset, kept by HdfFile so
+//  that reading a record or two at a time is served from memory.
+//  The scale factor of the dataset is kept with it.
+//-------------------------------------------------------------------
+
+#define HDF_BLOCK_RECORDS   1024
+
+class HdfDatasetBlock
+{
+public:
+    HdfDatasetBlock(int32 sdsId);
+    ~HdfDatasetBlock();
+
+    int32      datasetID;
+    int        cacheable;      // 1 if one dimensional and readable
+    int32      recordSize;     // bytes per record
+    int32      numRecords;     // records in the dataset
+    int32      first;          // first record in the block
+    int32      count;          // records in the block, 0 if empty
+    char*      data;
+
+    int        haveScale;      // 1 once the scale factor was asked for
+    int        scaleStatus;    // HDF_SUCCEED | HDF_FAIL
+    float64    scaleFactor;
+};
+
+inline int operator==(const HdfDatasetBlock& a, const HdfDatasetBlock& b)
+{
+    return(a.datasetID == b.datasetID ? 1 : 0);
+}
+
 //-------------------------------------------------------------------
 // HdfFile:
 //  This is an base class used as a generic HDF File.
@@ -166,6 +199,15 @@ public:
     //------------------------------------------------------
     StatusE         OpenFile(void);
 
+    //------------------------------------------------------
+    // close the file and open it again by name, so this
+    // process has descriptors of its own.  Use it after a
+    // fork(): the inherited descriptors share their file
+    // offset with the other process, and the HDF library
+    // keeps its own idea of that offset.
+    //------------------------------------------------------
+    StatusE         ReopenFile(void);
+
     //------------------------------------------------------
     // get the info about the global attributes
     // then get the global attributes themselves
@@ -223,6 +265,8 @@ public:
     //------------------------------------------------------
     // read one dimensional dataset, return HDF_SUCCEED or HDF_FAIL
     // use GetStatus() to get detailed error status
+    // short reads with stride 1 are served from a block of
+    // HDF_BLOCK_RECORDS records read ahead from the dataset
     //------------------------------------------------------
     virtual int     GetDatasetData1D(
                                 int32   datasetID,     // IN
@@ -261,7 +305,12 @@ protected:
     StatusE         _DupFilename(const char* filename);
     void            _CloseFile(void);
 
+    HdfDatasetBlock* _GetBlock(int32 datasetID);
+    void            _FreeBlock(int32 datasetID);
+    void            _FreeBlocks(void);
+
     EAList<int32>   _datasetIDs;
+    EAList<HdfDatasetBlock> _blocks;
 
     int32           _SDfileID;
     int32           _hFileID;
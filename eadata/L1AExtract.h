@@ -577,5 +577,10 @@ int ExtractHdrPcktLen(TlmHdfFile*, int32*, int32, int32, int32, VOIDP,
 int ExtractL1ADeltaSrcSeqCnt(TlmHdfFile*, int32*, int32, int32, int32, VOIDP, 
                                             PolynomialTable* polyTable);
 
+// true if the function remembers the previous extraction
+// (deltas, rates), so the frames must be extracted in order
+IotBoolean ExtractFuncKeepsState(int (*func)(TlmHdfFile*, int32*, int32,
+                          int32, int32, VOIDP, PolynomialTable*));
+
 
 #endif //L1AEXTRACT_H
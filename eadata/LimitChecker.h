@@ -44,6 +44,11 @@ typedef char (*WriteFunc) (char* string, void* value);
 //*********************************************************//
 typedef void (*assignBtoAFunc) (void* a, void* b);
 
+//*********************************************************//
+// all ToDoubleFunc : out[i] = (double) values[i]         //
+//*********************************************************//
+typedef void (*ToDoubleFunc) (void* values, int count, double* out);
+
 //*****************************************************************
 // LimitChecker:
 //        Each instance of LimitChecker represents an entry in
@@ -51,6 +56,7 @@ typedef void (*assignBtoAFunc) (void* a, void* b);
 //*****************************************************************
 
 class PolynomialTable;
+class Polynomial;
 
 class LimitChecker
 {
@@ -107,6 +113,18 @@ public:
 
     LimitStatusE        _checkValue(LimitStatePair* state, void* value);
 
+                        // check count values, all in the same state
+    void                _checkValues(LimitStatePair* state, void* values,
+                                int count, LimitStatusE* statuses);
+
+                        // the limits (cl, ch, al, ah) of the state
+    inline const double* _getLimits(LimitStatePair* state);
+
+                        // the polynomial of the parameter, or
+                        // the error status if there is none
+    LimitStatusE        _selectPolynomial(PolynomialTable* polyTable,
+                                const Polynomial*& polynomial);
+
     void                _checkStatus(
                             TlmHdfFile*     tlmFile,
                             int32           startIndex,
@@ -123,6 +141,7 @@ public:
     aEQbFunc            _aEQb;
     assignBtoAFunc      _assignBtoA;
     ReadLimitLine       _readLimitLine;
+    ToDoubleFunc        _toDouble;
 
     Parameter*          _parameter;
     char                _enable;
@@ -136,6 +155,25 @@ public:
     size_t              _bytes;
     LimitStatePair*     _statePair;
 
+    //========================================
+    // _limits compiled into doubles (exact for
+    // every limit type), rebuilt after SetLimits
+    //========================================
+    int                 _numLimits;     // elements in _limits
+    double*             _compiledLimits;
+    char                _limitsCompiled;
+
+    // values of one frame, as doubles, and their statuses
+    double*             _valueBuf;
+    int                 _valueBufSize;
+    LimitStatusE*       _statusBuf;
+    int                 _statusBufSize;
+
+    // the last polynomial table looked up, and its result
+    PolynomialTable*    _polyTable;
+    const Polynomial*   _polynomial;
+    LimitStatusE        _polyStatus;
+
     virtual char        _initialize(void);
 
 
@@ -100,6 +100,24 @@ public:
     virtual StatusE    HoldExtract(TlmHdfFile*       tlmFile,
                                    int32             startIndex,
                                    PolynomialTable*  polyTable=0);
+    //------------------------------------------------------------
+    // HoldExtract in two steps, so that the reading can be done
+    // somewhere else: ExtractRecord extracts every parameter at
+    // startIndex into a record of RecordSize() bytes (a state byte
+    // and the value of each parameter), HoldRecord then holds the
+    // record exactly as HoldExtract would have.  CanHoldRecords
+    // is false when a value depends on the previous extraction.
+    //------------------------------------------------------------
+    enum { RECORD_NO_VALUE, RECORD_VALUE, RECORD_ERROR };
+
+    virtual IotBoolean CanHoldRecords(void);
+    int                RecordSize(void);
+    virtual StatusE    ExtractRecord(TlmHdfFile*       tlmFile,
+                                     int32             startIndex,
+                                     char*             record,
+                                     PolynomialTable*  polyTable=0);
+    virtual StatusE    HoldRecord(const char* record);
+
     virtual StatusE    PrePrint();
     virtual StatusE    Print(FILE* fp);
     virtual StatusE    PrintACEgr(FILE* fp,
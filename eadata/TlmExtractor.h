@@ -0,0 +1,119 @@
+//=========================================================
+// Copyright  (C)1995, California Institute of Technology.
+// U.S. Government sponsorship under
+// NASA Contract NAS7-1260 is acknowledged
+//
+//
+// CM Log
+// $Log$
+//
+// $Date$
+// $Revision$
+// $Author$
+//
+//
+//=========================================================
+
+#ifndef TLMEXTRACTOR_H
+#define TLMEXTRACTOR_H
+
+static const char rcs_id_TlmExtractor_h[] = "@(#) $Header$";
+
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "CommonDefs.h"
+#include "ParameterList.h"
+#include "TlmFileList.h"
+#include "TlmHdfFile.h"
+#include "Filter.h"
+#include "PolyTable.h"
+
+//--------------------------------------------------------------
+// TlmExtractor extracts a parameter list from every file of a
+// TlmFileList, applying the filter set, exactly as the extract
+// loop of the eaprograms did.
+//
+// With more than one worker, each file is read by a child process
+// (HDF is not thread safe), which opens the file again by name and
+// writes the extracted records (ParameterList::ExtractRecord) to a
+// temporary file.  The records are held (ParameterList::HoldRecord)
+// in file order as the workers finish, so the parameter list ends
+// up the same as when the files are read one after another.
+// Parameter lists whose values depend on the previous frame (see
+// ParameterList::CanHoldRecords) are always extracted in order.
+//
+// A worker that fails is not an error: its file is opened again
+// and read in this process.  With StopAtFirstError, Extract returns as soon as
+// an error is seen (the running workers are stopped and the rest
+// of the files are left in the list), as the eaprograms did when
+// they aborted through the EALog.
+//--------------------------------------------------------------
+
+class TlmExtractor
+{
+public:
+    enum StatusE
+    {
+        OK,
+        ERROR_OPENING_DATASETS,
+        ERROR_OPENING_FILTER_DATASETS,
+        ERROR_EXTRACTING_PARAMETER
+    };
+
+    TlmExtractor(ParameterList*    paramList,
+                 FilterSet*        filterSet,    // may be 0
+                 PolynomialTable*  polyTable,    // may be 0
+                 int               numWorkers,
+                 const char*       programName);
+
+    virtual ~TlmExtractor();
+
+    // removes and deletes the files from the list
+    StatusE      Extract(TlmFileList* tlmFileList);
+
+    // true if the files can be read by the workers
+    IotBoolean   CanUseWorkers(void);
+
+    // return from Extract at the first error
+    void         StopAtFirstError(IotBoolean stop) { _stopAtFirstError = stop; };
+
+    StatusE      GetStatus() const { return (_status); };
+
+protected:
+    // the worker reports these in its exit code
+    enum
+    {
+        WORKER_PARAM_OPEN_FAILED = 0x01,
+        WORKER_FILTER_OPEN_FAILED = 0x02,
+        WORKER_CLOSE_FAILED = 0x04,
+        WORKER_WRITE_FAILED = 0x08
+    };
+
+    struct Worker
+    {
+        TlmHdfFile*  tlmFile;
+        FILE*        recordFP;
+        pid_t        pid;
+    };
+
+    void         _ExtractFile(TlmHdfFile* tlmFile);
+    void         _Hold(ParameterList::StatusE paramStatus);
+    IotBoolean   _StartWorker(TlmHdfFile* tlmFile, Worker* worker);
+    int          _RunWorker(TlmHdfFile* tlmFile, FILE* recordFP);
+    void         _FinishWorker(Worker* worker);
+    void         _StopWorker(Worker* worker);
+    void         _SetStatus(StatusE status);
+    IotBoolean   _Stopped(void) const
+                     { return (_stopAtFirstError && _status != OK); };
+
+    ParameterList*    _paramList;
+    FilterSet*        _filterSet;
+    PolynomialTable*  _polyTable;
+    int               _numWorkers;
+    const char*       _programName;
+    StatusE           _status;
+    IotBoolean        _stopAtFirstError;
+};
+
+#endif //TLMEXTRACTOR_H
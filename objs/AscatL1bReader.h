@@ -3,6 +3,12 @@
 
 #include <vector>
 
+struct stat;
+struct AscatBlock;
+struct AscatBlocks;
+struct AscatSZFRaw;
+struct AscatSZFRawNew;
+
 /////////////////////////////////////////
 // header file for ascat level 1b reader
 /////////////////////////////////////////
@@ -107,6 +113,9 @@ typedef struct {
 // size = size of mdr
 // id = subclass of mdr
 // sat = satellite
+// map = the file mapped into memory
+// blocks = records decoded a block at a time
+// threads = threads decoding blocks
 
 class AscatFile
 {
@@ -120,7 +129,38 @@ class AscatFile
 
  unsigned char *mdr;
 
-
+ unsigned char *map;
+ size_t map_size;
+ int map_is_mmap;
+
+ int threads;
+ AscatBlocks *blocks;
+
+ int map_file( );
+ void index_mdrs( size_t pos );
+ AscatBlock *current_block( );
+ int next_block( );
+ void wait_ahead( );
+ void load_block( AscatBlock *blk, int first, int thread_count );
+ static void *load_ahead( void *arg );
+ static void decode_record( int index, int thread_idx, void *arg );
+
+ void decode_node( unsigned char *x, int i, int beam, AscatSZFNode *b,
+                  AscatSZFRaw *r ) const;
+ void decode_node_new( unsigned char *x, int i, AscatSZFNodeNew *b,
+                       AscatSZFRawNew *r ) const;
+ // decode szf node data from mdr x, keeping its scaled integers in r
+
+ static void scale_node( const AscatSZFRaw *r, AscatSZFNode *b );
+ static void scale_node_new( const AscatSZFRawNew *r, AscatSZFNodeNew *b );
+ // set the fields made from the scaled integers r (decoding and cache
+ // reading both do it here, so they give the same nodes)
+
+ int read_cache_header( FILE *f, const struct stat &st, int *num_mdr );
+ int start_cache( const char* cache_fname, const struct stat &st );
+ void finish_cache( );
+ int read_cache_block( AscatBlock *blk );
+ int write_cache_block( AscatBlock *blk );
 
  public:
  int fmt_maj, fmt_min;
@@ -146,6 +186,15 @@ class AscatFile
  int open( const char* fname, int *nr, int *nn );
  // open a file for reading
 
+ int open_cache( const char* fname, const char* cache_fname, int *nr, int *nn );
+ // open an szf file for reading through a cache of its decoded
+ // nodes: the cache is read if it was written from this file,
+ // otherwise the file is read and the cache is written
+
+ void set_threads( int thread_count );
+ // decode records on thread_count threads (< 1 means one per CPU),
+ // a block ahead of read_mdr when there is more than one
+
  int read_mdr( int *isdummy );
  // read an mdr from the file
 
@@ -7,6 +7,8 @@
 #define BUFFEREDLIST_H
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
 #include "List.h"
 
 static const char rcs_id_bufferedlist_h[] =
@@ -24,6 +26,10 @@ static const char rcs_id_bufferedlist_h[] =
 // DESCRIPTION
 //		The BufferedList object is a doubly linked list of Nodes.  The list
 //		can be traversed forwards and backwards.
+//
+//		With SetPrefetch(), a reader thread keeps up to window records
+//		decoded ahead of the list so GetOrReadNext does not wait on the
+//		input file.  The reader owns the input file while it runs.
 //======================================================================
 
 template <class T>
@@ -41,6 +47,8 @@ public:
 
 	int		SetInputFile(const char* filename);
 	int		SetMaxNodes(unsigned int max_nodes);
+	int		SetPrefetch(unsigned int window);
+	int		StopPrefetch();
 	int		CloseInputFile();
 
 	//--------------------//
@@ -51,6 +59,10 @@ public:
 
 protected:
 
+	T*				_ReadNext();
+	static void*	_PrefetchMain(void* arg);
+	void			_InitPrefetch();
+
 	//-----------//
 	// variables //
 	//-----------//
@@ -58,6 +70,21 @@ protected:
 	FILE*			_inputFp;
 	unsigned int	_maxNodes;
 	unsigned int	_numNodes;
+
+	//----------//
+	// prefetch //
+	//----------//
+
+	unsigned int	_prefetchWindow;	// 0 when not prefetching
+	int				_prefetchStop;
+	int				_prefetchEof;
+	T**				_prefetchRing;
+	unsigned int	_prefetchHead;
+	unsigned int	_prefetchCount;
+	pthread_t		_prefetchThread;
+	pthread_mutex_t	_prefetchMutex;
+	pthread_cond_t	_prefetchNotEmpty;
+	pthread_cond_t	_prefetchNotFull;
 };
 
 
@@ -69,6 +96,7 @@ template <class T>
 BufferedList<T>::BufferedList()
 :	_inputFp(NULL), _maxNodes(0), _numNodes(0)
 {
+	_InitPrefetch();
 	return;
 }
 
@@ -78,6 +106,7 @@ BufferedList<T>::BufferedList(
 	unsigned int	max_nodes)
 :	_inputFp(input_fp), _maxNodes(max_nodes), _numNodes(0)
 {
+	_InitPrefetch();
 	return;
 }
 
@@ -85,6 +114,9 @@ template <class T>
 BufferedList<T>::~BufferedList()
 {
 	CloseInputFile();
+	pthread_mutex_destroy(&_prefetchMutex);
+	pthread_cond_destroy(&_prefetchNotEmpty);
+	pthread_cond_destroy(&_prefetchNotFull);
 
     T* data;
     List<T>::GetHead();
@@ -98,16 +130,24 @@ BufferedList<T>::~BufferedList()
 // BufferedList::SetInputFile //
 //----------------------------//
 
+// If records are being read ahead, the reader thread is stopped and
+// joined before the file is swapped, then restarted on the new file
+// with the same window.
+
 template <class T>
 int
 BufferedList<T>::SetInputFile(
 	const char*		filename)
 {
+	unsigned int window = _prefetchWindow;
+	StopPrefetch();			// the reader must not touch the old file
 	CloseInputFile();		// in case it is open already
 	_inputFp = fopen(filename, "r");
 	if (_inputFp == NULL)
 		return(0);
 
+	if (window > 0)
+		return(SetPrefetch(window));
 	return(1);
 }
 
@@ -124,6 +164,71 @@ BufferedList<T>::SetMaxNodes(
 	return(1);
 }
 
+//---------------------------//
+// BufferedList::SetPrefetch //
+//---------------------------//
+// Starts a reader thread that keeps up to window records read ahead
+// of the list.  The input file must already be set.  A window of 0
+// stops prefetching.  Returns 1 on success, 0 on failure.
+
+template <class T>
+int
+BufferedList<T>::SetPrefetch(
+	unsigned int	window)
+{
+	StopPrefetch();
+	if (window == 0)
+		return(1);
+	if (_inputFp == NULL)
+		return(0);
+
+	_prefetchRing = (T**)malloc(window * sizeof(T*));
+	if (_prefetchRing == NULL)
+		return(0);
+
+	_prefetchWindow = window;
+	_prefetchStop = 0;
+	_prefetchEof = 0;
+	_prefetchHead = 0;
+	_prefetchCount = 0;
+	if (pthread_create(&_prefetchThread, NULL, _PrefetchMain, this) != 0)
+	{
+		free(_prefetchRing);
+		_prefetchRing = NULL;
+		_prefetchWindow = 0;
+		return(0);
+	}
+	return(1);
+}
+
+//----------------------------//
+// BufferedList::StopPrefetch //
+//----------------------------//
+// Stops the reader thread.  Records that were read ahead but not yet
+// handed out are discarded, so the input file is left past them.
+
+template <class T>
+int
+BufferedList<T>::StopPrefetch()
+{
+	if (_prefetchWindow == 0)
+		return(1);
+
+	pthread_mutex_lock(&_prefetchMutex);
+	_prefetchStop = 1;
+	pthread_cond_broadcast(&_prefetchNotFull);
+	pthread_mutex_unlock(&_prefetchMutex);
+	pthread_join(_prefetchThread, NULL);
+
+	for (unsigned int i = 0; i < _prefetchCount; i++)
+		delete _prefetchRing[(_prefetchHead + i) % _prefetchWindow];
+	free(_prefetchRing);
+	_prefetchRing = NULL;
+	_prefetchCount = 0;
+	_prefetchWindow = 0;
+	return(1);
+}
+
 //------------------------------//
 // BufferedList::CloseInputFile //
 //------------------------------//
@@ -132,6 +237,7 @@ template <class T>
 int
 BufferedList<T>::CloseInputFile()
 {
+	StopPrefetch();
 	if (_inputFp)
 	{
 		fclose(_inputFp);
@@ -165,8 +271,8 @@ BufferedList<T>::GetOrReadNext()
 	else
 	{
 		// At the tail (or empty list), so try to read in another node.
-		T* new_data = new T;		// make a new data space
-		if (new_data->Read(_inputFp))
+		T* new_data = _ReadNext();
+		if (new_data != NULL)
 		{
 			// successful read, so Append the new data.
 			Append(new_data);
@@ -186,11 +292,117 @@ BufferedList<T>::GetOrReadNext()
 		}
 		else
 		{
-			// unsuccessful read, so get rid of the newly allocated data space
-			delete new_data;
 			return(NULL);
 		}
 	}
 	return(NULL);	// should never get here
 }
+
+//-------------------------//
+// BufferedList::_ReadNext //
+//-------------------------//
+// Returns the next record from the input file, or NULL at the end of
+// the file.  When prefetching, the record comes from the reader thread.
+
+template <class T>
+T*
+BufferedList<T>::_ReadNext()
+{
+	if (_prefetchWindow == 0)
+	{
+		T* new_data = new T;		// make a new data space
+		if (new_data->Read(_inputFp))
+			return(new_data);
+
+		// unsuccessful read, so get rid of the newly allocated data space
+		delete new_data;
+		return(NULL);
+	}
+
+	pthread_mutex_lock(&_prefetchMutex);
+	while (_prefetchCount == 0 && ! _prefetchEof)
+		pthread_cond_wait(&_prefetchNotEmpty, &_prefetchMutex);
+
+	T* new_data = NULL;
+	if (_prefetchCount > 0)
+	{
+		new_data = _prefetchRing[_prefetchHead];
+		_prefetchHead = (_prefetchHead + 1) % _prefetchWindow;
+		_prefetchCount--;
+		pthread_cond_signal(&_prefetchNotFull);
+	}
+	pthread_mutex_unlock(&_prefetchMutex);
+	return(new_data);
+}
+
+//-----------------------------//
+// BufferedList::_PrefetchMain //
+//-----------------------------//
+// Body of the reader thread.  Reads records until the end of the file
+// or until StopPrefetch, waiting whenever the window is full.
+
+template <class T>
+void*
+BufferedList<T>::_PrefetchMain(
+	void*	arg)
+{
+	BufferedList<T>* list = (BufferedList<T>*)arg;
+	for (;;)
+	{
+		pthread_mutex_lock(&list->_prefetchMutex);
+		while (list->_prefetchCount == list->_prefetchWindow &&
+			! list->_prefetchStop)
+		{
+			pthread_cond_wait(&list->_prefetchNotFull, &list->_prefetchMutex);
+		}
+		int stop = list->_prefetchStop;
+		pthread_mutex_unlock(&list->_prefetchMutex);
+		if (stop)
+			break;
+
+		// read outside the lock so the consumer is never held up
+		T* new_data = new T;
+		int ok = new_data->Read(list->_inputFp);
+
+		pthread_mutex_lock(&list->_prefetchMutex);
+		if (ok)
+		{
+			unsigned int tail = (list->_prefetchHead + list->_prefetchCount)
+				% list->_prefetchWindow;
+			list->_prefetchRing[tail] = new_data;
+			list->_prefetchCount++;
+		}
+		else
+		{
+			delete new_data;
+			list->_prefetchEof = 1;
+		}
+		pthread_cond_signal(&list->_prefetchNotEmpty);
+		pthread_mutex_unlock(&list->_prefetchMutex);
+		if (! ok)
+			break;
+	}
+	return(NULL);
+}
+
+//-----------------------------//
+// BufferedList::_InitPrefetch //
+//-----------------------------//
+
+template <class T>
+void
+BufferedList<T>::_InitPrefetch()
+{
+	_prefetchWindow = 0;
+	_prefetchStop = 0;
+	_prefetchEof = 0;
+	_prefetchRing = NULL;
+	_prefetchHead = 0;
+	_prefetchCount = 0;
+	pthread_mutex_init(&_prefetchMutex, NULL);
+	pthread_cond_init(&_prefetchNotEmpty, NULL);
+	pthread_cond_init(&_prefetchNotFull, NULL);
+	return;
+}
+
 #endif
@@ -53,6 +53,35 @@ public:
 
 };
 
+// Table index bracket and interpolation weights along one table axis
+typedef struct {
+    int i0, i1;
+    float a, b;
+} CAPInterp;
+
+// A measurement packed by CAPGMF::PackMeas; the incidence angle bracket
+// does not change during a retrieval.
+typedef struct {
+    float value;
+    float A;
+    float eastAzimuth;
+    int met_idx;
+    int cross_pol;
+    CAPInterp inc;
+} CAPPackedMeas;
+
+// The measurements of one cell, packed for CAPGMF::ObjectiveFunctionPacked
+class CAPMeasPack {
+public:
+    int has_tb;     // tb_ml was given (also adds the speed prior)
+    int has_s0;
+    float anc_sst;
+    CAPInterp sst;
+    CAPInterp swh;
+    std::vector<CAPPackedMeas> tb;
+    std::vector<CAPPackedMeas> s0;
+};
+
 class CAPGMF {
 public:
     CAPGMF();
@@ -72,6 +101,18 @@ public:
         float anc_sst, float anc_spd_std_prior, float active_weight = 1,
         float passive_weight = 1);
 
+    int PackMeas(
+        MeasList* tb_ml, MeasList* s0_ml, float anc_sst, float anc_swh,
+        CAPMeasPack* pack);
+
+    // same as ObjectiveFunctionCAP for the packed measurements; a term
+    // with zero weight is still evaluated, so an inf or NaN in it makes
+    // the objective NaN, as in ObjectiveFunctionCAP
+    double ObjectiveFunctionPacked(
+        const CAPMeasPack* pack, float trial_spd, float trial_dir,
+        float trial_sss, float anc_spd, float anc_spd_std_prior,
+        float active_weight, float passive_weight);
+
     double ObjectiveFunctionActive(
         MeasList* s0_ml, float trial_spd, float trial_dir, float anc_swh,
         float anc_spd);
@@ -141,6 +182,20 @@ protected:
         Meas::MeasTypeE met, float inc_in, float spd, float dir_in, float swh,
         float***** table, float* interpolated_value);
 
+    void _Bracket(
+        float value, float min, float step, int count, CAPInterp* w);
+    void _IncBracket(float inc_in, CAPInterp* w);
+    void _SSTBracket(float sst_in, CAPInterp* w);
+    void _SWHBracket(float swh, CAPInterp* w);
+
+    float _InterpolateFlat(
+        float*** table, const CAPInterp* inc_w, const CAPInterp* sst_w,
+        float sss);
+
+    float _InterpolateRough(
+        float**** table, const CAPInterp* inc_w, const CAPInterp* swh_w,
+        float spd, float dir_in);
+
     static const int _incCount = 11;
     static const float _incMin = 35;
     static const float _incStep = 1.0;
@@ -0,0 +1,85 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef CAPRETRIEVAL_H
+#define CAPRETRIEVAL_H
+
+#include <vector>
+#include "Meas.h"
+#include "CAPGMF.h"
+#include "CAPWind.h"
+#include "CAPWindSwath.h"
+
+// One cell queued for CAPBatchRetrieval
+class CAPRetrievalCell {
+public:
+    int cti;
+    int ati;
+    float init_spd;
+    float init_sss;
+    float select_dir;   // ambiguity selected nearest this direction
+    float anc_spd;
+    float anc_spd_std_prior;
+    float active_weight;
+    float passive_weight;
+    CAPMeasPack pack;
+    CAPWVC* wvc;
+};
+
+// Builds the CAP solution curves (as CAPGMF::BuildSolutionCurvesTwoStep)
+// of many cells on threads.  The measurements of each cell are packed
+// when it is added, so the MeasLists may be freed afterwards.
+//
+// The cells of a cross track column are done in along track order by
+// one thread.  With warm_start, a cell whose along track neighbour
+// (ati - 1, same cti) was done starts each azimuth from the neighbour's
+// speed and salinity at that azimuth, with a small COBYLA initial step.
+// The neighbour is remembered from one call to the next, so a swath can
+// be done in blocks of rows; the results do not depend on the thread
+// count.
+class CAPBatchRetrieval {
+public:
+    CAPBatchRetrieval(CAPGMF* cap_gmf, int ncti);
+    ~CAPBatchRetrieval();
+
+    int Add(
+        int cti, int ati, MeasList* tb_ml, MeasList* s0_ml, float init_spd,
+        float init_sss, float select_dir, float anc_spd, float anc_sst,
+        float anc_swh, float anc_spd_std_prior, float active_weight,
+        float passive_weight, CAPWVC* wvc);
+
+    int BuildSolutionCurvesTwoStep(int thread_count, int warm_start = 0);
+
+    // builds the ambiguities of each cell (in the order added) and adds
+    // those with any to the swath; the others are deleted
+    int AddToSwath(CAPWindSwath* cap_wind_swath);
+
+    int GetCellCount() { return(_cells.size()); };
+    CAPRetrievalCell* GetCell(int idx) { return(_cells[idx]); };
+
+    // forgets the cells (not the along track neighbours); the CAPWVCs
+    // are not deleted
+    void Clear();
+
+protected:
+
+    static void _RunColumn(int index, int thread_idx, void* arg);
+
+    CAPGMF* _capGMF;
+    int _ncti;
+    int _warmStart;
+    std::vector<CAPRetrievalCell*> _cells;
+    std::vector<std::vector<int> > _columns;    // cell indices by cti
+
+    // last cell done in each column
+    std::vector<int> _lastAti;
+    std::vector<std::vector<float> > _lastSpd;
+    std::vector<std::vector<float> > _lastSss;
+
+    // nlopt optimizers for each thread, made when first needed
+    std::vector<void*> _optimizers;
+};
+
+#endif
@@ -0,0 +1,109 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef CALTABLEDRIVER_H
+#define CALTABLEDRIVER_H
+
+static const char rcs_id_caltabledriver_h[] =
+    "@(#) $Id$";
+
+#include <stdio.h>
+#include <pthread.h>
+
+//======================================================================
+// CLASSES
+//    CalTableDriver
+//======================================================================
+
+// computes the values of one (beam, orbit step) cell; thread_idx
+// selects the caller's per-thread instrument and spacecraft
+typedef int (*CalTableCellFunc)(int beam_idx, int orbit_step,
+    int thread_idx, double* values, void* arg);
+
+//======================================================================
+// CLASS
+//    CalTableDriver
+//
+// DESCRIPTION
+//    The CalTableDriver object runs the (beam, orbit step) cells of a
+//    calibration table generator (X factor, DTC, RGC) on threads.
+//    Each cell fills a fixed number of doubles, stored by beam and
+//    orbit step, so the table does not depend on the order in which
+//    the cells finish.
+//
+//    Finished cells are appended to a journal file as they are done.
+//    A run which is stopped can be resumed from its journal: the cells
+//    already in it are read back (bit for bit) and are not computed
+//    again.
+//======================================================================
+
+class CalTableDriver
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    CalTableDriver();
+    ~CalTableDriver();
+
+    int  Allocate(int beam_count, int orbit_steps, int values_per_cell);
+
+    //---------//
+    // journal //
+    //---------//
+
+    int  OpenJournal(const char* filename, int resume);
+    int  CloseJournal(int remove_file);
+
+    //---------//
+    // running //
+    //---------//
+
+    int  Run(int thread_count, CalTableCellFunc cell_func, void* arg);
+
+    //--------//
+    // access //
+    //--------//
+
+    double*   GetCell(int beam_idx, int orbit_step);
+    double**  GetBeam(int beam_idx);    // [orbit_step][value]
+    int       GetDoneCount();
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    void  _Free();
+    int   _ReadJournal();
+    int   _WriteCell(int beam_idx, int orbit_step);
+
+    static void  _RunCell(int index, int thread_idx, void* arg);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    int         _beamCount;
+    int         _orbitSteps;
+    int         _valuesPerCell;
+    double***   _values;      // [beam][orbit_step][value]
+    char**      _done;        // [beam][orbit_step]
+
+    char*             _journalFilename;
+    FILE*             _journalFp;
+    pthread_mutex_t   _journalMutex;
+
+    // used while running
+    int*              _todo;
+    CalTableCellFunc  _cellFunc;
+    void*             _cellArg;
+    int               _failed;
+};
+
+#endif
@@ -27,6 +27,8 @@ static const char rcs_id_configsim_h[] =
 #include "FbbTable.h"
 #include "Rain.h"
 #include "YahyaAntenna.h"
+#include "MLPData.h"
+#include "Quat.h"
 
 //======================================================================
 // DESCRIPTION
@@ -137,6 +139,8 @@ int  ConfigL2AToL2B(L2AToL2B* l2a_to_l2b, ConfigList* config_list);
 //-----------//
 
 int  ConfigEphemeris(Ephemeris* ephemeris, ConfigList* config_list);
+int  ConfigEphemerisPrefetch(Ephemeris* ephemeris, ConfigList* config_list);
+int  ConfigAttitudePrefetch(QuatFile* quat_file, ConfigList* config_list);
 
 //-----------//
 // WindField //
@@ -189,6 +193,12 @@ int  ConfigControl(SpacecraftSim* spacecraft_sim, ConfigList* config_list,
 
 int  ConfigAttitude(ConfigList* config_list);
 
+//--------------//
+// MLP training //
+//--------------//
+
+int  ConfigMLPTraining(MLPDataArray* mlp_array, ConfigList* config_list);
+
 //-----------------//
 // helper function //
 //-----------------//
@@ -167,6 +167,8 @@ static const char rcs_id_configsimdefs_h[] =
 #define LANDMAP_TYPE_KEYWORD            "LANDMAP_TYPE"
 #define LANDMAP_LAT_START_KEYWORD            "LANDMAP_LAT_START"
 #define LANDMAP_LON_START_KEYWORD            "LANDMAP_LON_START"
+#define LANDMAP_TILE_CACHE_KEYWORD           "LANDMAP_TILE_CACHE"
+#define LANDMAP_USE_MMAP_KEYWORD             "LANDMAP_USE_MMAP"
 #define USE_LANDMAP_KEYWORD             "USE_LANDMAP"
 #define LAND_SIGMA0_INNER_BEAM_KEYWORD  "LAND_SIGMA0_INNER_BEAM"  // linear
 #define LAND_SIGMA0_OUTER_BEAM_KEYWORD  "LAND_SIGMA0_OUTER_BEAM"  // linear
@@ -250,6 +252,10 @@ static const char rcs_id_configsimdefs_h[] =
 #define L1A_FILE_FORMAT_KEYWORD  "L1A_FILE_FORMAT"
 #define L1A_HDF_FILE_KEYWORD     "L1A_HDF_FILE"
 
+#define L1A_HDF_FRAME_CLUSTER_KEYWORD  "L1A_HDF_FRAME_CLUSTER"
+#define L1A_HDF_CHUNK_FRAMES_KEYWORD   "L1A_HDF_CHUNK_FRAMES"
+#define L1A_HDF_DEFLATE_LEVEL_KEYWORD  "L1A_HDF_DEFLATE_LEVEL"
+
 //-----//
 // L1B //
 //-----//
@@ -267,6 +273,7 @@ static const char rcs_id_configsimdefs_h[] =
 #define SLICE_GAIN_THRESHOLD_KEYWORD     "SLICE_GAIN_THRESHOLD"
 #define PROCESS_MAX_SLICES_KEYWORD       "PROCESS_MAX_SLICES"
 #define ONEB_CHECKFILE_KEYWORD           "ONEB_CHECKFILE"
+#define L1A_TO_L1B_THREADS_KEYWORD       "L1A_TO_L1B_THREADS"
 
 
 
@@ -330,6 +337,8 @@ static const char rcs_id_configsimdefs_h[] =
 
 #define EPHEMERIS_FILE_KEYWORD  "EPHEMERIS_FILE"
 #define ATTITUDE_FILE_KEYWORD   "ATTITUDE_FILE"
+#define EPHEMERIS_PREFETCH_KEYWORD  "EPHEMERIS_PREFETCH"
+#define ATTITUDE_PREFETCH_KEYWORD   "ATTITUDE_PREFETCH"
 
 //------------//
 // Truth Wind //
@@ -358,6 +367,9 @@ static const char rcs_id_configsimdefs_h[] =
 #define USE_3D_RAIN_MODEL_KEYWORD           "USE_3D_RAIN_MODEL"
 #define RAIN_REFL_ATTN_FILE_KEYWORD         "RAIN_REFL_ATTN_FILE"
 #define RAIN_SPLASH_FILE_KEYWORD            "RAIN_SPLASH_FILE"
+#define RAIN_COLUMN_TABLE_KEYWORD           "RAIN_COLUMN_TABLE"
+#define RAIN_COLUMN_INC_STEP_KEYWORD        "RAIN_COLUMN_INC_STEP"
+#define RAIN_COLUMN_AZI_STEP_KEYWORD        "RAIN_COLUMN_AZI_STEP"
 
 //-------------------------------//
 // Rain Correction and Flagging  //
@@ -413,6 +425,9 @@ static const char rcs_id_configsimdefs_h[] =
 //----------//
 
 #define KPM_FIELD_FILE_KEYWORD  "KPM_FIELD_FILE"
+#define KPM_FIELD_CORRLENGTH_KEYWORD  "KPM_FIELD_CORRLENGTH"
+#define KPM_FIELD_ON_DEMAND_KEYWORD   "KPM_FIELD_ON_DEMAND"
+#define KPM_FIELD_SEED_KEYWORD        "KPM_FIELD_SEED"
 
 //----------//
 // AttenMap //
@@ -456,6 +471,15 @@ static const char rcs_id_configsimdefs_h[] =
 
 #define INSTRUMENT_TIME_BUFFER_KEYWORD  "INSTRUMENT_TIME_BUFFER"
 
+//--------------//
+// MLP training //
+//--------------//
+
+#define MLP_TRAIN_BATCH_SIZE_KEYWORD    "MLP_TRAIN_BATCH_SIZE"
+#define MLP_TRAIN_BATCH_STEP_KEYWORD    "MLP_TRAIN_BATCH_STEP"
+#define MLP_TRAIN_THREADS_KEYWORD       "MLP_TRAIN_THREADS"
+#define MLP_TRAIN_CELL_THREADS_KEYWORD  "MLP_TRAIN_CELL_THREADS"
+
 //-------------------------//
 // geodetic vs. geocentric //
 //-------------------------//
@@ -477,5 +501,6 @@ static const char rcs_id_configsimdefs_h[] =
 #define PTGR_SEED             944
 
 #define DEFAULT_KPRC_SEED             11456
+#define DEFAULT_KPM_FIELD_SEED        30817
 
 #endif
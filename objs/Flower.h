@@ -12,6 +12,7 @@ static const char rcs_id_flower_h[] =
 #include <stdio.h>
 #include "GMF.h"
 #include "L2AH.h"
+#include "FlowerField.h"
 
 //======================================================================
 // CLASSES
@@ -162,6 +163,9 @@ public:
                  int center_ati, float gamma, int use_rain_flag);
     Flower*  LocalVectorsProb(DistProb* dp, int window_size, int center_cti,
                  int center_ati, float gamma, int use_rain_flag);
+    int      LocalProbs(FlowerField::LocalMethodE method, DistProb* dp,
+                 int window_size, float gamma, int use_rain_flag,
+                 float min_prob, FlowerArray* dest, int thread_count = 0);
     int      SelectBestDirections();
 
     //-----------//
@@ -169,6 +173,22 @@ public:
     //-----------//
 
     Flower* array[CT_WIDTH][AT_WIDTH];
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    Flower*  _LocalProb(FlowerField::LocalMethodE method, DistProb* dp,
+                 int window_size, int center_cti, int center_ati,
+                 float gamma, int use_rain_flag, float min_prob);
+    int      _FillField(FlowerField* field, int min_cti, int min_ati,
+                 int ct_width, int at_width);
+    int      _SetFieldDistProb(FlowerField* field, DistProb* dp,
+                 int window_size);
+    Flower*  _NewLocalFlower(Flower* op0, int cti, int ati,
+                 const float* prob);
 };
 
 //======================================================================
@@ -0,0 +1,142 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef FLOWERFIELD_H
+#define FLOWERFIELD_H
+
+static const char rcs_id_flowerfield_h[] =
+    "@(#) $Id$";
+
+#include <vector>
+#include "Index.h"
+
+//======================================================================
+// CLASSES
+//    FlowerField
+//======================================================================
+
+// Flower.h and ObProb.h can not be used together, so the field keeps
+// its own copy of their direction count and WVC spacing.  Flower.C and
+// ObProb.C check that the direction counts agree.
+
+#define FIELD_DIR_BINS        72
+#define FIELD_WVC_RESOLUTION  25.0    // km
+
+//======================================================================
+// CLASS
+//    FlowerField
+//
+// DESCRIPTION
+//    The FlowerField object holds a block of flowers (all of a swath,
+//    or one window) in one contiguous (cti, ati, dir, spd) array: for
+//    every WVC and direction a probability and the speed for that
+//    direction.  It computes the local probabilities of
+//    FlowerArray::LocalFlowerProb, LocalVectorProb, LocalVectorsProb
+//    and ObProbArray::LocalFlowerProb, LocalVectorProb for one WVC or
+//    for all of them, the latter on several threads.
+//
+//    SetDistProb() collapses the DistProb table over distance for each
+//    distinct neighbour offset in the window and tabulates the delta
+//    direction interpolation of every direction pair, so a neighbour
+//    direction pair costs a trilinear kernel lookup instead of a full
+//    DistProb::Probability call.  Neighbours that DistProb can not
+//    estimate reject the WVC, as before.
+//======================================================================
+
+class FlowerField
+{
+public:
+
+    // FLOWER_PROB conditions on the neighbour speed (FlowerArray),
+    // CENTER_FLOWER_PROB on the center speed (ObProbArray).
+    enum LocalMethodE { FLOWER_PROB, CENTER_FLOWER_PROB, VECTOR_PROB,
+        VECTORS_PROB };
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    FlowerField();
+    ~FlowerField();
+
+    int   Allocate(int ct_width, int at_width);
+    int   SetCell(int cti, int ati, const float* prob, const float* speed,
+              int rain_flag, int selected_dir_idx);
+    int   SetDistProb(Index* distance_index, Index* speed_index,
+              Index* dspeed_index, Index* ddirection_index,
+              const unsigned long* count, const unsigned long* sum,
+              unsigned long minimum_samples, int window_size);
+
+    //--------//
+    // access //
+    //--------//
+
+    int   GetCtWidth() { return(_ctWidth); };
+    int   GetAtWidth() { return(_atWidth); };
+    int   IsPresent(int cti, int ati)
+              { return(_present[cti * _atWidth + ati]); };
+
+    //------------//
+    // processing //
+    //------------//
+
+    int   LocalCellProb(LocalMethodE method, float gamma, int use_rain_flag,
+              float min_prob, float min_norm_prob, int cti, int ati,
+              float* dest_prob);
+    int   LocalProb(LocalMethodE method, float gamma, int use_rain_flag,
+              float min_prob, float min_norm_prob, float* dest_prob,
+              int thread_count = 0);
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    int   _KernelProb(const double* kernel, int sp_idx, float sp_coef0,
+              float sp_coef1, float dspeed, int dd_pair, float* prob);
+    void  _LocalCell(LocalMethodE method, float gamma, int use_rain_flag,
+              float min_prob, float min_norm_prob, int cell,
+              float* dest_prob);
+
+    static void  _LocalRow(int ati, int thread_idx, void* arg);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    int  _ctWidth;
+    int  _atWidth;
+
+    // per WVC, indexed by cti * _atWidth + ati
+    std::vector<unsigned char>  _present;
+    std::vector<unsigned char>  _rainFlag;
+    std::vector<int>            _selected;
+
+    // per WVC and direction, indexed by cell * FIELD_DIR_BINS + dir_idx
+    std::vector<float>  _prob;
+    std::vector<float>  _speed;
+
+    // DistProb collapsed over distance, one kernel per distinct
+    // squared offset: [speed][dspeed][ddirection], with a flag per
+    // speed bin saying both distance bins have enough samples
+    int                                         _halfWindow;
+    std::vector<int>                            _kernelOfD2;   // -1 if none
+    std::vector< std::vector<double> >          _kernel;
+    std::vector< std::vector<unsigned char> >   _kernelOk;
+
+    // speed and delta speed indices, copied from the DistProb
+    Index  _speedIndex;
+    float  _dsMin, _dsMax, _dsStep;
+    int    _dsBins;
+    int    _ddBins;
+
+    // delta direction interpolation for every direction pair
+    std::vector<int>    _ddIdx;    // -1 if out of range
+    std::vector<float>  _ddCoef0;
+    std::vector<float>  _ddCoef1;
+};
+
+#endif
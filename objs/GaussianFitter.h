@@ -0,0 +1,99 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef GAUSSIANFITTER_H
+#define GAUSSIANFITTER_H
+
+static const char rcs_id_gaussianfitter_h[] =
+    "@(#) $Id$";
+
+#define GAUSSIAN_FITTER_MAX_BEAMS  4
+#define GAUSSIAN_FITTER_SEGMENT    32    // spots per warm start chain
+
+//======================================================================
+// CLASSES
+//    GaussianFitter
+//======================================================================
+
+//======================================================================
+// CLASS
+//    GaussianFitter
+//
+// DESCRIPTION
+//    The GaussianFitter object fits amp * exp(-((x - center)/width)^2)
+//    + bias to a profile (e.g. the slice energies of a spot) with a
+//    Levenberg-Marquardt solver using the analytic Jacobian.  The
+//    center and width are held within the bounds, as the simplex
+//    evaluation functions do.
+//
+//    Each beam keeps the center and width of its last good fit, and
+//    the next fit for that beam starts from them.  A warm start which
+//    does not converge is retried from the peak window estimate.
+//
+//    FitBatch fits many spots on threads.  The spots of each beam are
+//    cut into chains of GAUSSIAN_FITTER_SEGMENT.  The first chain of a
+//    beam starts from the warm start held before the batch, the others
+//    from the peak window estimate, and each chain warm starts the rest
+//    of its spots in order, so the results do not depend on the thread
+//    count.
+//======================================================================
+
+class GaussianFitter
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    GaussianFitter();
+    ~GaussianFitter();
+
+    //---------//
+    // setting //
+    //---------//
+
+    void  SetBounds(double min_center, double max_center, double min_width,
+              double max_width);
+    void  ResetWarmStarts();
+
+    //---------//
+    // fitting //
+    //---------//
+
+    int  Fit(int beam_idx, double* x, double* y, int points, double* center,
+             double* width);
+    int  FitBatch(int count, int* beam_idx, double* x, double** y,
+             int points, double* center, double* width, char* ok,
+             int thread_count);
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    int  _Solve(double* x, double* y, int points, const double* start,
+             double* center, double* width) const;
+    int  _FitFrom(double* x, double* y, int points, const double* start,
+             double* center, double* width) const;
+    void _Clamp(double* p) const;
+
+    static void  _FitSegment(int index, int thread_idx, void* arg);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    double  _minCenter;
+    double  _maxCenter;
+    double  _minWidth;
+    double  _maxWidth;
+
+    int     _warmValid[GAUSSIAN_FITTER_MAX_BEAMS];
+    double  _warm[GAUSSIAN_FITTER_MAX_BEAMS][2];    // center, width
+};
+
+#endif
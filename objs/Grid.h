@@ -14,6 +14,8 @@ static const char rcs_id_grid_h[] =
 #include "L1B.h"
 #include "L2A.h"
 #include "Meas.h"
+#include "MeasPool.h"
+#include "MeasPack.h"
 
 
 //======================================================================
@@ -131,6 +133,8 @@ protected:
 	double			_orbit_period;
 
 	OffsetListList**	_grid;			// the grid of lists of offset lists
+	MeasArray		_spotMeas;		// pooled slices of one spot (compositing)
+	MeasPack		_rowPack;		// packed slices of one row (compositing)
         bool _writeIndices;
  
 
@@ -90,11 +90,18 @@ protected:
 // DESCRIPTION
 //		The KpmField object manages a global grid of spatially correlated
 //		deviations which are used to represent model function errors
-//		when relating wind speed and direction to sigma0.
+//		when relating wind speed and direction to sigma0.  The field is
+//		white noise smoothed by a separable gaussian filter.  Build()
+//		makes the whole globe; BuildOnDemand() makes square tiles of the
+//		same field only where GetRV() asks for them (the band around the
+//		simulated ground track).  The noise is a hash of the cell index,
+//		so a tile has the same values no matter when it is made.
 //======================================================================
 
 #define STEPS_PER_CORRLENGTH	5
 #define N_CORRLENGTHS_INTEGRATE	5
+#define KPM_FIELD_TILE_CELLS	64
+#define KPM_FIELD_MAX_TILES		1024
 
 class KpmField
 {
@@ -107,6 +114,9 @@ public:
 	KpmField();
 	~KpmField();
 	int Build(float corr_length);
+	int BuildOnDemand(float corr_length,
+			int max_tiles = KPM_FIELD_MAX_TILES);
+	void SetSeed(unsigned long seed) { _seed = seed; };
 
 	//--------------//
 	// access
@@ -115,23 +125,45 @@ public:
 	float GetRV(Kpm* kpm, Meas::MeasTypeE meas_type, float wspd,
         LonLat lon_lat);
 	float GetRV(double kpm_value, LonLat lon_lat);
+	int IsOnDemand() { return(_tiles != NULL); };
 
     //-----------//
     // variables //
     //-----------//
 
-	// The two fields of random values, one correlated, the other not.
+	// The correlated field (from Build or Read).
 	EarthField corr;
-	EarthField uncorr;
 
 protected:
 
+	int		_Setup(float corr_length);
+	void	_FreeTiles();
+	float	_Noise(int lon_idx, int lat_idx);
+	void	_Filter(int lon_start, int lon_count, int lat_start,
+				int lat_count, float** out);
+	int		_GetCell(int lon_idx, int lat_idx, float* value);
+	int		_InterpolateTiles(LonLat lon_lat, float* value);
+
 	// Supplies gaussian random values with unit variance and zero mean.
 	Gaussian _gaussianRv;
 
 	// Spatial correlation length (km) of this field.
 	float _corrLength;
 
+	// grid (cell i,j is at lon = i*_step, lat = -pi/2 + j*_step)
+	unsigned long	_seed;
+	double			_step;
+	int				_lonCount;
+	int				_latCount;
+
+	// on demand tiles, indexed by tile_lon * _tileLatCount + tile_lat
+	float***		_tiles;
+	long*			_lastUse;
+	int				_tileLonCount;
+	int				_tileLatCount;
+	int				_tileCount;
+	int				_maxTiles;
+	long			_useClock;
 };
 
 #endif
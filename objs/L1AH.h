@@ -21,13 +21,19 @@ static const char rcs_id_l1ah_h[] =
 
 #define FRAME_TIME_NAME  "frame_time"
 
+// a frame time record is a code B string without the terminator
+#define FRAME_TIME_RECORD_SIZE  (CODE_B_TIME_LENGTH - 1)
+
 //======================================================================
 // CLASS
 //    L1AH
 //
 // DESCRIPTION
 //    The L1AH class is a subclass of L1A that allows for the writing
-//    of L1A HDF files.
+//    of L1A HDF files.  With a frame cluster greater than one, the
+//    SDSs and the frame time Vdata are buffered and written that many
+//    frames at a time.  EndVdataOutput and EndSDSOutput write out
+//    whatever is still buffered.
 //======================================================================
 
 class L1AH : public L1A
@@ -35,13 +41,19 @@ class L1AH : public L1A
 public:
 
     L1AH();
+    ~L1AH();
 
     int  NextRecord();
 
+    // call these before CreateSDSs
+    int  SetFrameCluster(int frames);
+    int  SetChunking(int chunk_frames, int deflate_level = 0);
+
     int  OpenHdfForWriting();
     int  OpenHdfForReading();
     int  CreateVdatas();
     int  WriteVdatas();
+    int  FlushVdatas();
     int  EndVdataOutput();
 
     int  OpenSDSForWriting();
@@ -78,6 +90,12 @@ protected:
     int32   _sdsOutputFileId;
 
     int     _currentRecordIdx;
+
+    // buffered output
+    int     _frameCluster;
+    char*   _frameTimeBuffer;
+    int     _frameTimeCount;
+    int     _frameTimeStart;
 };
 
 #endif
@@ -20,9 +20,56 @@ static const char rcs_id_l1atol1b_h[] =
 
 //======================================================================
 // CLASSES
-//    L1AToL1B
+//    L1AToL1BFrame, L1AToL1B
+//======================================================================
+
+// how far ahead of the frame (in seconds, roughly 600 km of ground
+// track) land map tiles are prefetched
+#define LAND_PREFETCH_TIME  90.0
+
+//======================================================================
+// CLASS
+//    L1AToL1BFrame
+//
+// DESCRIPTION
+//    The L1AToL1BFrame object holds one frame on its way through the
+//    conversion: the unpacked frame (for the frame-parallel mode), the
+//    cal/load state carried forward to it, the spacecraft orbit state
+//    of each spot, and the spots made from it.
 //======================================================================
 
+class L1AToL1BFrame
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    L1AToL1BFrame();
+    ~L1AToL1BFrame();
+
+    int  Allocate(L1AFrame* like);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    L1AFrame       frame;           // only used by ConvertFrames
+    OrbitState*    spotOrbitState;  // one per spot
+    int            maxSpots;
+    MeasSpotList   spotList;
+    unsigned long  pulseCount;      // pulse count of the first spot
+    int            converted;       // 0 if the conversion failed
+
+    float   Esn_echo_cal;
+    float   Esn_noise_cal;
+    float   En_echo_load;
+    float   En_noise_load;
+    float   Es_cal;
+    double  beta;
+};
+
 //======================================================================
 // CLASS
 //    L1AToL1B
@@ -31,6 +78,13 @@ static const char rcs_id_l1atol1b_h[] =
 //    The L1AToL1B object is used to convert between Level 1A data
 //    and Level 1B data.  It performs all of the engineering unit
 //    conversions.
+//
+//    ConvertFrames converts a block of frames at once, geolocating
+//    the frames on threads, each with its own instrument and
+//    spacecraft.  The cal/load state, the orbit states and the land
+//    map stay with the calling thread: FinishFrame sets the land flags,
+//    composites and puts the spots in the L1B frame, and must be
+//    called for the frames in order.
 //======================================================================
 
 class L1AToL1B
@@ -50,6 +104,15 @@ public:
 
     int  Convert(L1A* l1a, Spacecraft* spacecraft, Qscat* qscat,
              Ephemeris* ephemeris, Topo* topo, Stable* stable, L1B* l1b);
+    int  CanConvertFrames();
+    int  ConvertFrames(L1AToL1BFrame* frames, int frame_count,
+             Spacecraft** spacecraft, Qscat** qscat, int thread_count,
+             Ephemeris* ephemeris, Topo* topo, Stable* stable);
+    int  ConvertFrameSpots(L1AToL1BFrame* l1a_to_l1b_frame,
+             Spacecraft* spacecraft, Qscat* qscat, Topo* topo,
+             Stable* stable);
+    int  FinishFrame(L1AToL1BFrame* l1a_to_l1b_frame, L1B* l1b);
+
     int  ComputeSigma0(Qscat* qscat, Meas* meas, float Xfactor, float Esn_slice,
                    float Esn_echo, float Esn_noise, float En_echo_load,
                    float En_noise_load, float* Es_slice, float* En_slice);
@@ -71,11 +134,22 @@ public:
     float  sliceGainThreshold;      // use to decide which slices to process
     int    processMaxSlices;        // maximum number of slices/spot to use
     char*  simVs1BCheckfile;        // holds cross check data
+    int    numThreads;              // threads for ConvertFrames
 
     float  Esn_echo_cal;    // Cal pulse data to be used.
     float  Esn_noise_cal;
     float  En_echo_load;
     float  En_noise_load;
+
+protected:
+
+    int  _PrepareFrame(L1AFrame* frame, Qscat* qscat, Ephemeris* ephemeris,
+             L1AToL1BFrame* l1a_to_l1b_frame);
+    int  _ConvertSpots(L1AFrame* frame, L1AToL1BFrame* l1a_to_l1b_frame,
+             Spacecraft* spacecraft, Qscat* qscat, Topo* topo,
+             Stable* stable);
+
+    L1AToL1BFrame  _frame;    // used by Convert
 };
 
 #endif
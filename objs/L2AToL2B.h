@@ -20,6 +20,7 @@ static const char rcs_id_l2atol2b_h[] =
   vartype *varname = (vartype *)malloc(numel * sizeof(vartype)); for(int i=0;i<numel;i++) varname[i] = 0;
 
 class MLPDataArray;
+struct L2AToL2BCellInputs;
 
 #define DESIRED_SOLUTIONS  4
 
@@ -80,6 +81,8 @@ public:
     // float GetNeuralDirectionOffset(L2A* l2a); // Obsolete routine
     float GetSpacecraftVelocityAngle(float atd, float ctd);
     int  ConvertAndWrite(L2A* l2a, GMF* gmf, Kp* kp, L2B* l2b);
+    int  ConvertAndWriteRow(L2A* l2a, L2AFrame** frames, int count,
+             GMF* gmf, Kp* kp, L2B* l2b, int* retvals);
     int  InitAndFilter(L2B* l2b);
     int  PopulateNudgeVectors(L2B* l2b);
     void RainCorrectSpeed(L2B*l2b);
@@ -183,6 +186,13 @@ public:
     int arrayNudgeFlag;
  protected:
     float computeGroundTrackParameters();
+
+    // stages of ConvertAndWriteRow
+    int   _PrepareWVC(L2A* l2a, GMF* gmf, WVC** wvc_out);
+    void  _ApplySigma0Correction(MeasList* meas_list, float* outp);
+    int   _RetrieveWVC(L2A* l2a, GMF* gmf, Kp* kp, WVC* wvc);
+    void  _RainMLPRow(WVC** wvcs, L2AToL2BCellInputs* cells, int* retvals,
+              int count);
     int _phiCount;
 
     float** arrayNudgeSpd;
@@ -2,6 +2,7 @@
 #define LCRESMap_H
 
 #include <stdlib.h>
+#include <pthread.h>
 #include <vector>
 #include <Eigen/SparseCore>
 #include "EarthPosition.h"
@@ -44,14 +45,41 @@ class LCRESMap {
 
 };
 
+// Blocked tile format: a LCRES_TILE_HEADER_SIZE byte header, a table
+// giving the block number (or -1) of each block of each of the 144
+// arrays, then the blocks of block_size x block_size floats holding
+// sum_dX_value / sum_dX, one after another.  The table is padded so
+// the blocks start on a page boundary; the blocks themselves (3600
+// bytes) are not padded.  Cells with no data hold NaN.
+#define LCRES_TILE_MAGIC        "LCRESBLK"
+#define LCRES_TILE_VERSION      1
+#define LCRES_TILE_HEADER_SIZE  4096
+#define LCRES_TILE_BLOCK_SIZE   30
+
+// tiles are 30 x 30 degrees
+#define LCRES_TILE_DEGREES      30
+#define LCRES_NUM_TILE_LONS     (360 / LCRES_TILE_DEGREES)
+#define LCRES_NUM_TILE_LATS     (180 / LCRES_TILE_DEGREES)
+#define LCRES_NUM_TILE_IDS      (LCRES_NUM_TILE_LONS * LCRES_NUM_TILE_LATS)
+
+// how far ahead of the spacecraft (seconds) tiles are prefetched
+#define LCRES_PREFETCH_TIME     300.0
+
+class OrbitState;
+
 class LCRESMapTile {
 
     public:
         LCRESMapTile(const char* filename = NULL);
         ~LCRESMapTile();
 
+        // Reads either a blocked tile (mapped) or an original sparse tile
+        // (converted to blocks in memory).
         int Read(const char* filename);
-        int Write(const char* filename);
+        int Write(const char* filename);  // writes the blocked format
+        int WriteSparse(const char* filename);  // writes the original format
+        int Prefetch();
+        int IsLoaded() { return(_data != NULL); };
 
         int Get(
             EarthPosition* pos, float east_azi, int ipol, int is_asc,
@@ -64,6 +92,9 @@ class LCRESMapTile {
     protected:
         int _GetIdx(double lon, double lat, float east_azi, int* iazi, int* ilon,
                     int* ilat);
+        int _ReadBlocked(int fd, size_t file_size);
+        int _ReadSparse(FILE* ifp);
+        void _Free();
 
         float _lat_min;
         static const int _nlat = 600;
@@ -76,12 +107,30 @@ class LCRESMapTile {
         static const float _dazi = 10.0;
         static const int _nazi = 36;
 
-        // Ascending VV, Descending VV, Ascending HH, Descending HH
-        std::vector<Eigen::SparseMatrix<float> > _sum_dX;
-        std::vector<Eigen::SparseMatrix<float> > _sum_dX_value;
-
+        static const int _nblon = _nlon / LCRES_TILE_BLOCK_SIZE;
+        static const int _nblat = _nlat / LCRES_TILE_BLOCK_SIZE;
+
+        // block table and blocks for Ascending VV, Descending VV,
+        // Ascending HH, Descending HH at each azimuth
+        char*        _data;
+        size_t       _dataLength;
+        int          _mapped;
+        const int*   _blockIdx;
+        const float* _blocks;
+
+    private:
+        // tiles own their (possibly mapped) data
+        LCRESMapTile(const LCRESMapTile&);
+        LCRESMapTile& operator=(const LCRESMapTile&);
 };
 
+//======================================================================
+// LCRESMapTileList keeps the most recently used tiles.  Tiles are found
+// by computing their id from lon and lat.  Get may be called from
+// several threads at once.  Prefetch loads tiles on a background
+// thread; tiles are read without holding the lock.
+//======================================================================
+
 class LCRESMapTileList{
 
     public:
@@ -100,16 +149,29 @@ class LCRESMapTileList{
             double lon, double lat, float east_azi, int ipol, int is_asc,
             float* value);
 
+        // Starts loading the tile under the ground track lead_time
+        // seconds ahead and returns without waiting for it.
+        int Prefetch(OrbitState* orbit_state,
+                double lead_time = LCRES_PREFETCH_TIME);
+
     protected:
 
-        std::vector<LCRESMapTile> tiles;
+        int _TileId(double lon, double lat);
+        int _LoadTile(int tile_id);
+        void _JoinPrefetch();
 
-        int _GetIfLoaded(
-            double lon, double lat, float east_azi, int ipol, int is_asc,
-            float* value);
+        static void* _PrefetchThread(void* arg);
 
-        int _FindAndLoadTile(double lon, double lat);
+        LCRESMapTile*  _tiles[LCRES_NUM_TILE_IDS];   // NULL if not cached
+        unsigned long  _lastUse[LCRES_NUM_TILE_IDS];
+        unsigned long  _useClock;
+        int            _cachedCount;
+        pthread_rwlock_t  _lock;
 
+        // background prefetch; _prefetchId is -1 when no load is running
+        pthread_t      _prefetchThread;
+        int            _prefetchStarted;
+        int            _prefetchId;
 };
 
 #endif
@@ -14,9 +14,34 @@ static const char rcs_id_landmap_h[] =
 
 //======================================================================
 // CLASSES
-//    LandMap, SimpleLandMap
+//    LandMapTile, LandMap, SimpleLandMap
 //======================================================================
 
+#define LANDMAP_DEFAULT_TILE_CACHE  9
+
+//======================================================================
+// CLASS
+//    LandMapTile
+//
+// DESCRIPTION
+//    The LandMapTile holds one 10 degree by 10 degree tile of the
+//    USGS land use map, either mapped read-only from the tile file or
+//    read into memory.  A tile whose file does not exist is kept with
+//    no data so that it is not looked for again.
+//======================================================================
+
+class LandMapTile
+{
+public:
+    int             lonStart;       // degrees
+    int             latStart;       // degrees
+    double          lonStartRad;
+    double          latStartRad;
+    unsigned char*  data;           // NULL if there is no tile file
+    size_t          mappedLength;   // 0 if data was read, not mapped
+    unsigned long   lastUse;
+};
+
 
 //======================================================================
 // CLASS
@@ -26,6 +51,12 @@ static const char rcs_id_landmap_h[] =
 //    The LandMap object contains a longitude and latitude map of
 //    where land occurs. It has a method which takes lon and lat
 //    returning 0 for ocean or 1 for land.
+//
+//    The USGS land use map (LANDUSE) is read a tile at a time.  The
+//    most recently used tiles are kept in a small cache, so swaths
+//    that straddle tile boundaries do not reload tiles, and
+//    PrefetchUSGS can be used to load the tiles ahead of the ground
+//    track before they are needed.
 //======================================================================
 //*********************************************************************//
 // YOU NEED TO CALL THE Initialize METHOD BEFORE USING THE LANDMAP     //
@@ -45,8 +76,17 @@ public:
 
     int  IsLand(float lon, float lat);
     int  IsLand(LonLat* lon_lat);
+    int  IsLand(int count, const float* lon, const float* lat, int* flags);
     int  IsCoastal(float lon, float lat, float thresh);
-    
+
+    //-------------------//
+    // USGS tile caching //
+    //-------------------//
+
+    int  SetTileCache(int max_tiles, int use_mmap = 1);
+    int  PrefetchUSGS(float lon, float lat);
+    int  IsTiled() { return(_usemap && landmap_type == 2); };
+
 protected:
 
     int  IsLandUSGS(float lon, float lat);
@@ -60,6 +100,14 @@ protected:
     int  _Allocate();
     int  _Deallocate();
 
+    LandMapTile*  _FindTile(float lon, float lat, int* lon_idx,
+                      int* lat_idx);
+    LandMapTile*  _LoadTile(int lon_start, int lat_start);
+    unsigned char*  _ReadTile(int fd, const char* fullname, size_t size,
+                        size_t* mapped_length);
+    void          _FreeTile(LandMapTile* tile);
+    void          _FreeTiles();
+
     //-----------//
     // variables //
     //-----------//
@@ -75,6 +123,14 @@ protected:
     double           _lonResolution;
     double           _latResolution;
     int landmap_type;  // 0 = LandMap, 1= SimpleLandMap, 2= USGS Landuse map
+
+    // USGS tile cache
+    LandMapTile*     _tiles;
+    int              _tileCount;
+    int              _maxTiles;
+    int              _useMmap;
+    LandMapTile*     _lastTile;
+    unsigned long    _useClock;
 };
 
 //======================================================================
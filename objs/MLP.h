@@ -2,6 +2,7 @@
 #define MLP_H
 
 #include "MLPData.h"
+#include "ParallelFor.h"
 
 /**** struct to store/ define the types of inputs ****/
 #define IO_TYPE_STR_MAX_LENGTH          64
@@ -20,6 +21,13 @@ struct MLP_IOType {
 #define MLP_IO_IN_TYPE      0
 #define MLP_IO_OUT_TYPE     1
 
+// number of input vectors evaluated together by ForwardBatch
+#define MLP_BATCH_BLOCK_SIZE    64
+
+// number of patterns of a mini-batch whose gradient one thread computes
+// in TrainBatch
+#define MLP_TRAIN_CHUNK_SIZE    16
+
 
 
 /***** Multi-Layer Perceptron Structure ***/
@@ -52,6 +60,8 @@ public:
   float* inpt;  /*** array for holding inputs ***/
   float moment;/*** momentum coefficient ***/
   float ssize; /*** training step size ****/
+  int numThreads; /*** threads used by TrainBatch and TrainVSS ***/
+  ParallelPool* trainPool; /*** their threads during an epoch, else NULL ***/
   
   MLP_IOType *in_types; /*** array correlating input number to what
                                should be used for that input ***/
@@ -106,6 +116,11 @@ public:
 
   /**** function to perform one epoch of backprop with momentum on MLP ***/
   float Train(MLPData* pattern,  float moment_value, float ssize_value);
+
+  /**** one epoch of mini-batch backprop with momentum: the gradient ***/
+  /**** is averaged over batch_size patterns before each update.     ***/
+  float TrainBatch(MLPData* pattern, float moment_value, float ssize_value,
+                   int batch_size);
   
   /** Variable Step Search Algorithm routines **/
   float TrainVSS(MLPData* pattern, int epochno);
@@ -117,6 +132,7 @@ public:
   int UpdateHiddenTable(MLPData* pattern, int hnum);
   float GetVSSError(MLPData* pattern);
   int VSSUpdateParam(MLPData* pattern,float* w, float* dw,int hnum,float d0,float c,float c2,float h,int nmax,int epochno);
+  int RunParallel(int count, ParallelBody body, void* arg);
 
 
  public:
@@ -129,6 +145,11 @@ public:
   int Forward();
   float ForwardMSE(float* inpts, float* doutx);
 
+  /**** forward passes for count input vectors; outpts[i] gets the ***/
+  /**** nout outputs for inpts[i], the same values Forward gives.   ***/
+  /**** inpt, hnout and outp are not changed.                       ***/
+  int ForwardBatch(int count, float** inpts, float** outpts);
+
   /*** a single backward pass ****/
   int Backward(float* inpts);
 
@@ -46,8 +46,10 @@ public:
   int Allocate();
   int Deallocate();
 
-  /*** Randomly shuffle samples in data set ***/
-  int Shuffle(float** old_inpt_ptrs=NULL, float** old_outpt_ptrs=NULL);
+  /*** Randomly shuffle samples in data set (with erand48(rand_state) ***/
+  /*** if rand_state is given, else drand48)                          ***/
+  int Shuffle(float** old_inpt_ptrs=NULL, float** old_outpt_ptrs=NULL,
+              unsigned short* rand_state=NULL);
 
   /*** Copy a data set ***/
   int Copy(MLPData* newptr);
@@ -105,6 +107,13 @@ class MLPDataArray{
   int writeMLPHeader();
   int trainMLPAndWrite();
   int _trainMLP(int nvalidsamps);
+  int _trainCell(int i, int j, MLPData* dataset, int nvalidsamps,
+                 unsigned short* rand_state);
+  // with cell_threads > 1 the filled DataSets are spooled and the
+  // MLPs are trained one anti-diagonal at a time when Flush is called
+  int spoolDataSet();
+  int trainWavefront();
+  static void _trainWavefrontCell(int index, int thread_idx, void* arg);
   int balanceWeights(MLP* m);
   float trainDirPdf(MLP* m, MLPData* d, float* nrms);
   float testDirPdf(MLP* m, MLPData* d, float* nrms);
@@ -114,6 +123,8 @@ class MLPDataArray{
   FILE* netfp;
   MLPData latestDataSet;
   MLP*** MLParray;
+  FILE* spoolfp;      // filled DataSets, binary, for trainWavefront
+  long* spoolOffset;  // [i*size2+j] offset in spoolfp, -1 if not filled
 
  public:
   int size1;
@@ -132,7 +143,6 @@ class MLPDataArray{
   int nMLPout;
   int nMLPhn;
  protected:
-  float* degdist;
   bool dirpdf;
 
  public:
@@ -142,6 +152,10 @@ class MLPDataArray{
   float moment;
   float ssize;
   bool vss;
+  int batch_size;  // patterns per backprop update; 0 means one at a time
+  float batch_ssize;  // step size for the mean gradient of a mini-batch
+  int nthreads;    // threads used by mini-batch and VSS training
+  int cell_threads;  // MLPs trained at once; 1 trains each as it fills
 };
 
 /********** Associated Functions ***************/
@@ -39,6 +39,7 @@ static const char rcs_id_meas_h[] =
 //======================================================================
 
 class MeasList;
+class MeasArray;
 class L1BHdf;
 class L2AHdf;
 
@@ -81,6 +82,7 @@ public:
     // compositing //
     //-------------//
     int CompositeObsKP(MeasList* meas_list);
+    int CompositeObsKP(MeasArray* meas_array);
     int Composite_Coastal(MeasList* meas_list);
     
     //--------------------------------------------------//
@@ -92,6 +94,7 @@ public:
     //--------------------------------------------------//
 
     int  Composite(MeasList* meas_list, int n = 0);
+    int  Composite(MeasArray* meas_array, int n = 0);
 
     //--------------//
     // input/output //
@@ -148,6 +151,12 @@ public:
     //------------------------//
 
     off_t  offset;    // byte offset in file
+
+protected:
+
+    // shared by the MeasList and MeasArray versions
+    template <class L> int  _CompositeObsKP(L* meas_list);
+    template <class L> int  _Composite(L* meas_list, int n);
 };
 
 //======================================================================
@@ -216,6 +225,7 @@ public:
 	~OffsetList();
 
 	int		MakeMeasList(FILE* fp, MeasList* meas_list);
+	int		MakeMeasArray(FILE* fp, MeasArray* meas_array);
 
 	//---------//
 	// freeing //
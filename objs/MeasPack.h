@@ -0,0 +1,116 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef MEASPACK_H
+#define MEASPACK_H
+
+static const char rcs_id_measpack_h[] =
+    "@(#) $Id$";
+
+#include <vector>
+#include "Meas.h"
+#include "MeasPool.h"
+
+//======================================================================
+// CLASSES
+//    MeasPack
+//======================================================================
+
+//======================================================================
+// CLASS
+//    MeasPack
+//
+// DESCRIPTION
+//    The MeasPack object holds the slices of many composites (for
+//    example, every spot of every WVC in a grid row) in packed
+//    per-field arrays.  Composite() forms all of the composites in
+//    one call and gives the same results as calling Meas::Composite
+//    or Meas::CompositeObsKP on each group of slices: the per-slice
+//    products are formed in flat loops over the whole pack and the
+//    per-composite sums are taken in the original slice order.
+//======================================================================
+
+class MeasPack
+{
+public:
+
+    enum CompositeMethodE { STANDARD, OBS_KP };
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    MeasPack();
+    ~MeasPack();
+
+    //---------//
+    // packing //
+    //---------//
+
+    void  Clear();
+    int   AddGroup(MeasArray* meas_array);    // returns the group index
+    int   AddGroup(MeasList* meas_list);
+
+    //-------------//
+    // compositing //
+    //-------------//
+
+    int  Composite(CompositeMethodE method = STANDARD);
+    int  GetComposite(int group, Meas* meas);    // 0 if not composited
+
+    //-------------//
+    // information //
+    //-------------//
+
+    int  GroupCount() { return((int)_groupStart.size()); };
+    int  SliceCount() { return((int)_value.size()); };
+
+protected:
+
+    void  _AddSlice(Meas* meas);
+    int   _EndGroup(int start, Meas* head);
+
+    //----------------------//
+    // per-slice variables  //
+    //----------------------//
+
+    std::vector<float>   _value;
+    std::vector<float>   _XK;
+    std::vector<float>   _EnSlice;
+    std::vector<float>   _bandwidth;
+    std::vector<float>   _incidenceAngle;
+    std::vector<float>   _eastAzimuth;
+    std::vector<float>   _A;
+    std::vector<int>     _startSliceIdx;
+    std::vector<int>     _landFlag;
+    std::vector<int>     _measType;
+    std::vector<double>  _cx, _cy, _cz;
+
+    // per-slice products, filled by Composite()
+    std::vector<double>  _ps, _ps2, _xkInc, _xkSin, _xkCos, _xk2a;
+
+    //----------------------//
+    // per-group variables  //
+    //----------------------//
+
+    std::vector<int>    _groupStart;
+    std::vector<int>    _groupCount;
+
+    // taken from the head slice of each group
+    std::vector<float>  _headTxPulseWidth;
+    std::vector<float>  _headScanAngle;
+    std::vector<float>  _headB, _headC;
+    std::vector<int>    _headBeamIdx;
+
+    // results, filled by Composite()
+    std::vector<int>     _valid;
+    std::vector<float>   _cValue, _cXK, _cEnSlice, _cBandwidth;
+    std::vector<float>   _cEastAzimuth, _cIncidenceAngle;
+    std::vector<float>   _cA, _cB, _cC;
+    std::vector<int>     _cLandFlag;
+    std::vector<double>  _cCx, _cCy, _cCz;
+};
+
+#endif
@@ -0,0 +1,151 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef MEASPOOL_H
+#define MEASPOOL_H
+
+static const char rcs_id_measpool_h[] =
+    "@(#) $Id$";
+
+#include <stdio.h>
+#include "Meas.h"
+
+//======================================================================
+// CLASSES
+//    MeasPool, MeasArray
+//======================================================================
+
+#define MEAS_POOL_BLOCK_SIZE  1024
+
+//======================================================================
+// CLASS
+//    MeasPool
+//
+// DESCRIPTION
+//    The MeasPool object is an arena for Meas objects.  Meas are
+//    handed out from contiguous blocks and all of them are returned
+//    at once with Reset(), typically once per frame or per rev.
+//    Blocks are kept across resets so steady-state processing does
+//    no heap allocation.  Meas from a pool must never be deleted.
+//======================================================================
+
+class MeasPool
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    MeasPool(int block_size = MEAS_POOL_BLOCK_SIZE);
+    ~MeasPool();
+
+    //------------//
+    // allocation //
+    //------------//
+
+    Meas*  Allocate();    // returns a default-valued Meas
+    void   Reset();       // all Meas become available again
+
+    //-------------//
+    // information //
+    //-------------//
+
+    int  AllocatedCount() { return(_used); };
+    int  Capacity() { return(_blockCount * _blockSize); };
+
+protected:
+
+    int  _AddBlock();
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    Meas**  _blocks;
+    int     _blockCount;
+    int     _blockSize;
+    int     _used;
+};
+
+//======================================================================
+// CLASS
+//    MeasArray
+//
+// DESCRIPTION
+//    The MeasArray object is a contiguous replacement for MeasList.
+//    Entries are stored in an array of Meas pointers into a MeasPool,
+//    so an index stays valid until the array is emptied.  Removed
+//    entries are left as holes that the GetHead/GetNext style
+//    traversal skips; Compact() squeezes them out.  The traversal
+//    methods behave like their List counterparts so a loop over a
+//    MeasList can be moved over by changing the declaration.
+//======================================================================
+
+class MeasArray
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    MeasArray(MeasPool* pool = NULL);
+    ~MeasArray();
+
+    //----------------//
+    // adding to list //
+    //----------------//
+
+    Meas*  NewMeas();    // append a pooled, default Meas
+
+    //--------------------//
+    // removing from list //
+    //--------------------//
+
+    Meas*  RemoveCurrent();    // remove current, next becomes current
+    int    Compact();          // drop holes; indices are renumbered
+    void   FreeContents();     // empty the array (Meas go back to pool)
+
+    //----------------------//
+    // retrieving from list //
+    //----------------------//
+
+    Meas*  GetHead();
+    Meas*  GetTail();
+    Meas*  GetCurrent();
+    Meas*  GetNext();
+    Meas*  GetPrev();
+    Meas*  GetByIndex(int index);    // current = index, may be a hole
+    int    GetCurrentIndex() { return(_current); };
+    Meas*  operator[](int index) { return(_meas[index]); };
+
+    //-------------//
+    // information //
+    //-------------//
+
+    int  NodeCount() { return(_count); };     // live entries
+    int  Size() { return(_size); };           // live entries + holes
+    int  IsEmpty() { return(_count == 0); };
+
+protected:
+
+    Meas*  _SkipHoles(int step);
+    int    _Reserve(int size);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    MeasPool*  _pool;
+    int        _ownPool;
+    Meas**     _meas;
+    int        _size;
+    int        _capacity;
+    int        _count;
+    int        _current;
+};
+
+#endif
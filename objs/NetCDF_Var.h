@@ -45,6 +45,11 @@ public:
     virtual ~NetCDF_Var_Base();
     int Define();
     int Write();
+    // Storage options; they only apply to netCDF-4 files and must be
+    // set before Define()
+    void SetChunking(const size_t *chunk_szs);
+    void SetLeadingChunking(size_t n);
+    void SetDeflate(int level, int shuffle = 0);
     void AddAttribute(NetCDF_Attr_Base *attr);
     int WriteAttributes();
     string &GetName() { return name; };
@@ -57,6 +62,9 @@ protected:
     int *dim_szs;
     int varid;
     int nelems;
+    vector <size_t> chunk_szs;
+    int deflate_level;
+    int shuffle;
     vector <NetCDF_Attr_Base *> attrs;
 
 private:
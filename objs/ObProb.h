@@ -12,6 +12,7 @@ static const char rcs_id_obprob_h[] =
 #include <stdio.h>
 #include "GMF.h"
 #include "L2AH.h"
+#include "FlowerField.h"
 
 //======================================================================
 // CLASSES
@@ -147,12 +148,31 @@ public:
                  int center_ati, float gamma);
     ObProb*  LocalVectorProb(DistProb* dp, int window_size, int center_cti,
                  int center_ati, float gamma);
+    int      LocalProbs(FlowerField::LocalMethodE method, DistProb* dp,
+                 int window_size, float gamma, ObProbArray* dest,
+                 int thread_count = 0);
 
     //-----------//
     // variables //
     //-----------//
 
     ObProb* array[CT_WIDTH][AT_WIDTH];
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    ObProb*  _LocalProb(FlowerField::LocalMethodE method, DistProb* dp,
+                 int window_size, int center_cti, int center_ati,
+                 float gamma);
+    int      _FillField(FlowerField* field, int min_cti, int min_ati,
+                 int ct_width, int at_width);
+    int      _SetFieldDistProb(FlowerField* field, DistProb* dp,
+                 int window_size);
+    ObProb*  _NewLocalObProb(ObProb* op0, int cti, int ati,
+                 const float* prob);
 };
 
 //======================================================================
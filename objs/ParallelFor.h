@@ -0,0 +1,109 @@
+//==============================================================//
+// Copyright (C) 2019, California Institute of Technology.      //
+// U.S. Government sponsorship acknowledged.                    //
+//==============================================================//
+
+#ifndef PARALLELFOR_H
+#define PARALLELFOR_H
+
+static const char rcs_id_parallelfor_h[] =
+    "@(#) $Id$";
+
+#include <pthread.h>
+
+//======================================================================
+// FUNCTIONS
+//    ParallelFor, ParallelThreadCount
+//
+// DESCRIPTION
+//    ParallelFor runs body(index, thread_idx, arg) for every index in
+//    [0, count) on up to thread_count pthreads.  Indices are handed out
+//    one at a time from a shared counter, so uneven work balances
+//    itself.  thread_idx is in [0, threads used) and can select
+//    per-thread scratch space.  With one thread (or one index) the
+//    loop runs in the calling thread.  Returns the number of threads
+//    used, or 0 if the threads could not be started.
+//
+//    ParallelThreadCount turns a requested count into a usable one:
+//    a request < 1 means one thread per online processor.
+//======================================================================
+
+typedef void (*ParallelBody)(int index, int thread_idx, void* arg);
+
+int  ParallelFor(int count, int thread_count, ParallelBody body, void* arg);
+int  ParallelThreadCount(int requested);
+
+//======================================================================
+// CLASS
+//    ParallelPool
+//
+// DESCRIPTION
+//    The ParallelPool object is a ParallelFor whose threads are kept
+//    between loops.  Start creates the threads, each Run hands them a
+//    loop (with the same index and thread_idx rules as ParallelFor)
+//    and waits for it, and Stop ends the threads.  Use it when many
+//    short loops are run in a row, e.g. the mini-batches of a training
+//    epoch, where creating the threads for every loop would cost more
+//    than the loop.
+//======================================================================
+
+struct ParallelPoolWorker;
+
+class ParallelPool
+{
+public:
+
+    //--------------//
+    // construction //
+    //--------------//
+
+    ParallelPool();
+    ~ParallelPool();
+
+    int  Start(int thread_count);
+    int  Stop();
+
+    //---------//
+    // running //
+    //---------//
+
+    int  Run(int count, ParallelBody body, void* arg);
+
+    //--------//
+    // access //
+    //--------//
+
+    int  GetThreadCount() { return(_threadCount); };
+
+protected:
+
+    //------------------//
+    // helper functions //
+    //------------------//
+
+    void  _Work(int thread_idx);
+
+    static void*  _WorkerMain(void* worker_ptr);
+
+    //-----------//
+    // variables //
+    //-----------//
+
+    int                  _threadCount;    // including the calling thread
+    pthread_t*           _threads;
+    ParallelPoolWorker*  _workers;
+    pthread_mutex_t      _mutex;
+    pthread_cond_t       _workReady;
+    pthread_cond_t       _workDone;
+
+    // the current loop
+    ParallelBody         _body;
+    void*                _arg;
+    int                  _count;
+    int                  _next;
+    int                  _generation;    // counts the loops handed out
+    int                  _busy;          // threads still in the loop
+    int                  _stop;
+};
+
+#endif
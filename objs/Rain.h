@@ -25,6 +25,11 @@ static const char rcs_id_rain_h[] =
 #define RAINCELL_DY 1.3 // in km
 #define DIELECTRIC_WATER_CONST_SQ 0.93
 
+// bins of the precomputed slant column tables (degrees)
+#define RAIN_COLUMN_INC_STEP 1.0
+#define RAIN_COLUMN_AZI_STEP 5.0
+#define RAIN_COLUMN_MAX_INC  75.0
+
 class RainField 
 {
 public:
@@ -62,6 +67,14 @@ public:
                      EarthPosition target, float incAngle,
                      CoordinateSwitch gc_to_rangeazim, float ambs0, float* combs0);
 
+    // precomputed slant columns (3-D model only)
+    int SetColumnTable(float inc_step, float azi_step);
+    int UsingColumnTable() { return(_colIncCount > 0); };
+    int SlantAttn(double lon, double lat, float inc, float look_azi,
+                  float* attn);
+    int SlantAmbEs(double lon, double lat, float inc, float look_azi,
+                   float ambs0, float* combs0);
+
     float lat_min, lat_max;
     float lon_min, lon_max;
     int num_lats, num_lons;
@@ -78,6 +91,17 @@ protected:
     int  _Deallocate();
     int  _Allocate();
 
+    //---------------//
+    // slant columns //
+    //---------------//
+
+    void  _FreeColumnTable();
+    int   _BuildColumnBin(int bin);
+    int   _SlantColumns(double lon, double lat, float inc, float look_azi,
+                        float* attn, float* amb_attn, float* refl);
+    void  _LookAngles(EarthPosition target, Vector3 rsat, double lon,
+                      double lat, float* path_inc, float* look_azi);
+
     //-----------//
     // variables //
     //-----------//
@@ -95,6 +119,17 @@ protected:
     float* hgtInc; // dz for each layer
     float*** A3;
     float*** vB3;
+
+    // Column sums along the slant path from each grid cell toward the
+    // spacecraft, one [lat][lon] table per (incidence, azimuth) bin,
+    // made the first time the bin is used.  Bin = inc * azi_count + azi.
+    float  _colIncStep;      // radians
+    float  _colAziStep;      // radians
+    int    _colIncCount;
+    int    _colAziCount;
+    float*** _colAttn;       // sum of A * hgtInc / 1000 (ComputeAttn)
+    float*** _colAmbAttn;    // sum of A * DZ_LAYER (ComputeAmbEs)
+    float*** _colRefl;       // reflectivity attenuated by the layers above
 };
 
 #endif
@@ -48,7 +48,11 @@ protected:
 //    Sds
 //
 // DESCRIPTION
-//    The Sds class holds generic SDS information.
+//    The Sds class holds generic SDS information.  The Set methods
+//    fill in one frame.  With a frame cluster larger than one, Write
+//    only buffers the frame and the cluster goes out in a single
+//    SDwritedata when it fills, when the record index jumps, or on
+//    Flush/EndAccess.
 //======================================================================
 
 class Sds
@@ -63,8 +67,10 @@ public:
 
     int FrameSize();
     int SetFrameCluster(int32 frames);
+    int SetChunking(int32 chunk_frames, int deflate_level = 0);
     int Create(int32 sds_id);
     int Write(int32 record_idx);
+    int Flush();
     int EndAccess();
 
     virtual int SetMaxAndMin();
@@ -83,8 +89,14 @@ protected:
     int32*   _edges;
     void*    _calibratedData;
 
+    void*    _FrameData();
+
     int      _frameSize;       // the number of elements per frame
     int      _frameCluster;    // the number of frames per i/o operation
+    int      _clusterFill;     // the number of frames buffered
+    int32    _clusterStart;    // the record index of the first buffered frame
+    int32    _chunkFrames;     // frames per HDF chunk (0 = not chunked)
+    int      _deflateLevel;    // deflate level for chunks (0 = none)
 };
 
 //======================================================================
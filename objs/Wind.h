@@ -269,6 +269,11 @@ public:
 #define NSCAT_TYPE        "NSCAT"
 #define NSCAT_LAND_VALUE  -9999.0
 
+// lookups use a packed copy of the field in square tiles of this many
+// cells, each with a one cell border so a bilinear lookup stays in a
+// single tile
+#define WIND_FIELD_TILE_CELLS  32
+
 class WindField : public LonLatWind
 {
 public:
@@ -303,6 +308,10 @@ public:
 
     int  NearestWindVector(LonLat lon_lat, WindVector* wv);
     int  InterpolatedWindVector(LonLat lon_lat, WindVector* wv);
+    int  NearestWindVectors(int count, const LonLat* lon_lat,
+             WindVector** wv, char* ok = NULL);
+    int  InterpolatedWindVectors(int count, const LonLat* lon_lat,
+             WindVector** wv, char* ok = NULL);
 
     //----------//
     // tweaking //
@@ -328,6 +337,17 @@ protected:
     int  _Allocate();
     int  _Deallocate();
 
+    //-------------//
+    // tiled copy  //
+    //-------------//
+
+    int   _PackTiles();
+    void  _FreeTiles();
+    int   _LonIndex(float longitude, int* lon_idx);
+    int   _InterpolateTiles(float longitude, float latitude, float* u,
+              float* v);
+    void  _ApplyOverrides(WindVector* wv);
+
     //-----------//
     // variables //
     //-----------//
@@ -343,6 +363,14 @@ protected:
     int    _useRandomDirection; // flag for using random direction
 
     WindVector***  _field;
+
+    // u, v and speed planes for each tile (NaN where there is no
+    // vector) and the original speed and direction, lon-major
+    float*  _tiles;
+    int     _tileLonCount;
+    int     _tileLatCount;
+    float*  _nearSpd;
+    float*  _nearDir;
 };
 
 //======================================================================
@@ -15,6 +15,7 @@ static const char rcs_id_echo_funcs_h[] =
 #include "Array.h"
 #include "Index.h"
 #include "ETime.h"
+#include "GaussianFitter.h"
 
 #define SPOTS_PER_FRAME  100
 
@@ -83,6 +84,15 @@ int     gaussian_fit(Qscat* qscat, double* x, double* y, int points,
             int use_precalc = 0);
 double  gfit_eval(double* x, void* ptr);
 double  gfit_eval_precalc(double* x, void* ptr);
+void    gaussian_fit_setup(GaussianFitter* fitter);
+int     gaussian_fit_lm(Qscat* qscat, GaussianFitter* fitter, int beam_idx,
+            double* x, double* y, int points, float* peak_slice,
+            float* peak_freq, float* width_freq);
+int     gaussian_fit_batch(Qscat* qscat, GaussianFitter* fitter, int count,
+            int* beam_idx, double* x, double** y, int points,
+            float* peak_freq, char* ok, int thread_count);
+int     slice_peak_to_freq(Qscat* qscat, float fslice, float width,
+            float* peak_slice, float* peak_freq, float* width_freq);
 
 float     est_sigma0(int beam_idx, float incidence_angle);
 double**  make_p(int p_count, double* p_init, double* p_lambda);
@@ -392,27 +402,10 @@ gaussian_fit(
     }
 
     float width = p[0][1];
-    if (width > TOO_WIDE)
-    {
-        free_p(p, ndim);
-        return(0);
-    }
-
-    //----------------------//
-    // transfer information //
-    //----------------------//
-
-    int near_slice_idx = (int)(fslice + 0.5);
-    float f1, bw, dummy;
-    qscat->ses.GetSliceFreqBw(near_slice_idx, &f1, &dummy);
-    qscat->ses.GetSliceFreqBw(5, &dummy, &bw);
-    *peak_slice = fslice;
-    *peak_freq = f1 + bw * (fslice - (float)near_slice_idx + 0.5);
-    *width_freq = bw * width;
-
     free_p(p, ndim);
 
-    return(1);
+    return(slice_peak_to_freq(qscat, fslice, width, peak_slice, peak_freq,
+        width_freq));
 }
 
 //-----------//
@@ -581,6 +574,112 @@ gfit_eval_precalc(
     return(sum_dif);
 }
 
+//--------------------//
+// gaussian_fit_setup //
+//--------------------//
+// holds the fitter to the same region as the simplex
+
+void
+gaussian_fit_setup(
+    GaussianFitter*  fitter)
+{
+    fitter->SetBounds(MIN_CENTER, MAX_CENTER, MIN_WIDTH, MAX_WIDTH);
+    return;
+}
+
+//-----------------//
+// gaussian_fit_lm //
+//-----------------//
+// like gaussian_fit, but uses the Levenberg-Marquardt fitter, which
+// starts from the last good fit of the same beam
+
+int
+gaussian_fit_lm(
+    Qscat*           qscat,
+    GaussianFitter*  fitter,
+    int              beam_idx,
+    double*          x,
+    double*          y,
+    int              points,
+    float*           peak_slice,
+    float*           peak_freq,
+    float*           width_freq)
+{
+    double center, width;
+    if (! fitter->Fit(beam_idx, x, y, points, &center, &width))
+        return(0);
+
+    return(slice_peak_to_freq(qscat, center, width, peak_slice, peak_freq,
+        width_freq));
+}
+
+//--------------------//
+// gaussian_fit_batch //
+//--------------------//
+// fits the profiles y[0..count-1] on threads (see
+// GaussianFitter::FitBatch) and sets ok[i] for the good peaks
+
+int
+gaussian_fit_batch(
+    Qscat*           qscat,
+    GaussianFitter*  fitter,
+    int              count,
+    int*             beam_idx,
+    double*          x,
+    double**         y,
+    int              points,
+    float*           peak_freq,
+    char*            ok,
+    int              thread_count)
+{
+    double* center = new double[count];
+    double* width = new double[count];
+    int retval = fitter->FitBatch(count, beam_idx, x, y, points, center,
+        width, ok, thread_count);
+    if (retval)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            float peak_slice, width_freq;
+            if (ok[i])
+            {
+                ok[i] = slice_peak_to_freq(qscat, center[i], width[i],
+                    &peak_slice, &(peak_freq[i]), &width_freq);
+            }
+        }
+    }
+    delete[] center;
+    delete[] width;
+    return(retval);
+}
+
+//--------------------//
+// slice_peak_to_freq //
+//--------------------//
+// rejects wide peaks and converts the peak slice to frequency
+
+int
+slice_peak_to_freq(
+    Qscat*  qscat,
+    float   fslice,
+    float   width,
+    float*  peak_slice,
+    float*  peak_freq,
+    float*  width_freq)
+{
+    if (width > TOO_WIDE)
+        return(0);
+
+    int near_slice_idx = (int)(fslice + 0.5);
+    float f1, bw, dummy;
+    qscat->ses.GetSliceFreqBw(near_slice_idx, &f1, &dummy);
+    qscat->ses.GetSliceFreqBw(5, &dummy, &bw);
+    *peak_slice = fslice;
+    *peak_freq = f1 + bw * (fslice - (float)near_slice_idx + 0.5);
+    *width_freq = bw * width;
+    return(1);
+}
+
 //------------//
 // est_sigma0 //
 //------------//